@@ -59,3 +59,69 @@ def config_etrace(cpu_cls, cpu_list, options):
     else:
         fatal("%s does not support data dependency tracing. Use a CPU model of"
               " type or inherited from DerivO3CPU.", cpu_cls)
+
+def config_branch_trace(cpu_list):
+    # Every cpu writes its own trace, named after its probe listener, which
+    # can then be replayed with configs/example/bpred_trace_replay.py
+    for cpu in cpu_list:
+        cpu.branchTraceListener = m5.objects.BranchTraceProbe(manager = cpu)
+
+def config_pc_profile(cpu_list, insts, cycles):
+    # Every cpu writes its own folded stack profile, named after its
+    # profiler, when the simulation exits
+    for cpu in cpu_list:
+        cpu.pcProfiler = m5.objects.PCProfiler(manager = cpu,
+                                               sample_insts = insts,
+                                               sample_cycles = cycles)
+
+def config_event_queues(cpu_list):
+    """Simulate each CPU by its own event queue, and thus host thread.
+
+    The CPU and its children, including its private caches, move to
+    event queue i + 1. The shared caches and crossbars stay on event
+    queue 0 as they are not thread-safe, and a CrossQueueBridge is
+    spliced into every connection between a child of the CPU and the
+    rest of the system. Cache hits in the private caches thus never
+    leave the thread of the CPU, only their misses, writebacks and
+    snoops cross the bridges.
+
+    This costs accuracy: the queues are only synchronized once per
+    simulation quantum, so a packet crossing a bridge sees the current
+    tick of the other queue, which may be up to a quantum apart. A
+    crossing that finds the other queue busy is refused and retried a
+    cycle later. Runs are therefore not deterministic, and timing
+    results should be compared to a single-threaded run.
+    """
+    from m5.params import VectorPortRef
+    from m5.proxy import isproxy
+
+    for i, cpu in enumerate(cpu_list):
+        # The children of the CPU inherit its event queue
+        cpu.eventq_index = i + 1
+        cpu_objs = list(cpu.descendants())
+        cpu_ids = set(id(obj) for obj in cpu_objs)
+
+        bridges = []
+        for obj in cpu_objs:
+            for ref in list(obj._port_refs.values()):
+                elements = ref.elements if isinstance(ref, VectorPortRef) \
+                    else [ ref ]
+                for port in elements:
+                    if not port.peer or isproxy(port.peer) or \
+                       id(port.peer.simobj) in cpu_ids:
+                        continue
+
+                    # The CPU side of the bridge faces the requestor,
+                    # which is the CPU unless the memory system sends
+                    # it requests, e.g., interrupts.
+                    bridge = m5.objects.CrossQueueBridge()
+                    if port.role == 'GEM5 REQUESTOR':
+                        bridge.eventq_index = 0
+                        bridge.cpu_side_eventq_index = i + 1
+                    else:
+                        bridge.eventq_index = i + 1
+                        bridge.cpu_side_eventq_index = 0
+                    port.splice(bridge.cpu_side_port, bridge.mem_side_port)
+                    bridges.append(bridge)
+
+        cpu.event_queue_bridges = bridges
@@ -249,6 +249,18 @@ def addCommonOptions(parser):
         "--elastic-trace-en", action="store_true",
         help="""Enable capture of data dependency and instruction
                       fetch traces using elastic trace probe.""")
+    parser.add_argument(
+        "--branch-trace-en", action="store_true",
+        help="""Enable capture of the branches retired by each CPU
+                      using branch trace probe.""")
+    parser.add_argument(
+        "--pc-profile-insts", type=int, default=0,
+        help="""Profile the guest code by sampling the PC and call stack
+                      of each CPU every this many retired instructions.""")
+    parser.add_argument(
+        "--pc-profile-cycles", type=int, default=0,
+        help="""Profile the guest code by sampling the PC and call stack
+                      of each CPU every this many cycles.""")
     # Trace file paths input to trace probe in a capture simulation and input
     # to Trace CPU in a replay simulation
     parser.add_argument("--inst-trace-file", action="store", type=str,
@@ -466,6 +478,16 @@ def addFSOptions(parser):
     parser.add_argument(
         "--timesync", action="store_true",
         help="Prevent simulated time from getting ahead of real time")
+    parser.add_argument(
+        "--cpu-event-queues", action="store_true",
+        help="Simulate each CPU in its own host thread, the memory system "
+        "is simulated by a thread of its own")
+    parser.add_argument(
+        "--sim-quantum", action="store", type=int, default=1000,
+        help="Ticks between synchronizations of the host threads when "
+        "simulating CPUs in parallel, packets crossing between the private "
+        "caches of a CPU and the memory system may see a time skewed by up "
+        "to this amount")
 
     # System options
     parser.add_argument("--kernel", action="store", type=str)
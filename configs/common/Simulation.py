@@ -78,8 +78,14 @@ def setCPUClass(options):
             TmpClass, test_mem_mode = getCPUClass(options.restore_with_cpu)
     elif options.fast_forward:
         CPUClass = TmpClass
-        TmpClass = AtomicSimpleCPU
-        test_mem_mode = 'atomic'
+        if getattr(options, 'cpu_event_queues', False):
+            # Fast-forward the CPUs in parallel. They read memory through
+            # backdoors, without crossing to the memory system thread.
+            TmpClass = NonCachingSimpleCPU
+            test_mem_mode = 'atomic_noncaching'
+        else:
+            TmpClass = AtomicSimpleCPU
+            test_mem_mode = 'atomic'
 
     # Ruby only supports atomic accesses in noncaching mode
     if test_mem_mode == 'atomic' and options.ruby:
@@ -474,6 +480,11 @@ def run(options, root, testsys, cpu_class):
             switch_cpus[i].progress_interval = \
                 testsys.cpu[i].progress_interval
             switch_cpus[i].isa = testsys.cpu[i].isa
+            # The switch CPU takes over the private caches of the CPU,
+            # and their bridges to the memory system, so it must run on
+            # the same event queue
+            if getattr(options, 'cpu_event_queues', False):
+                switch_cpus[i].eventq_index = testsys.cpu[i].eventq_index
             # simulation period
             if options.maxinsts:
                 switch_cpus[i].max_insts_any_thread = options.maxinsts
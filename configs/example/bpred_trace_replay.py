@@ -0,0 +1,69 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Replays a branch trace, captured with --branch-trace-en, through one or
+# more branch predictors without simulating a CPU, and reports their
+# mispredictions per kilo instruction for every class of branches in the
+# statistics.
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath('../')
+
+from common import ObjectList
+from common import Options
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument("trace_file", help="Branch trace to replay")
+parser.add_argument("--list-bp-types",
+                    action=Options.ListBp, nargs=0,
+                    help="List available branch predictor types")
+parser.add_argument("--bp-types", default="LTAGE",
+                    help="Comma separated list of the branch predictors to "
+                    "evaluate")
+parser.add_argument("--jobs", type=int, default=0,
+                    help="Number of predictors evaluated at the same time, "
+                    "0 for one per host core")
+
+args = parser.parse_args()
+
+predictors = []
+for bp_type in args.bp_types.split(','):
+    predictors.append(ObjectList.bp_list.get(bp_type)())
+
+root = Root(full_system = False)
+root.replay = BranchTraceReplay(trace_file = args.trace_file,
+                                predictors = predictors,
+                                jobs = args.jobs)
+
+m5.instantiate()
+exit_event = m5.simulate()
+print('Exiting @ tick %i because %s' %
+      (m5.curTick(), exit_event.getCause()))
@@ -44,11 +44,20 @@ addToPath('../')
 from common import Options
 from common import Simulation
 from common import CacheConfig
+from common import CpuConfig
 from common import MemConfig
 from common.Caches import *
 
 parser = argparse.ArgumentParser()
 Options.addCommonOptions(parser)
+parser.add_argument(
+    "--cpu-event-queues", action="store_true",
+    help="Replay the traces of each Trace CPU in its own host thread, the "
+    "memory system is simulated by a thread of its own")
+parser.add_argument(
+    "--sim-quantum", action="store", type=int, default=1000,
+    help="Ticks between synchronizations of the host threads when "
+    "replaying traces in parallel")
 
 if '--ruby' in sys.argv:
     print("This script does not support Ruby configuration, mainly"
@@ -63,15 +72,21 @@ if args.cpu_type != "TraceCPU":
     fatal("This is a script for elastic trace replay simulation, use "\
             "--cpu-type=TraceCPU\n");
 
-if args.num_cpus > 1:
-    fatal("This script does not support multi-processor trace replay.\n")
+# Each Trace CPU replays its own pair of traces, given as comma separated
+# lists of files
+inst_trace_files = args.inst_trace_file.split(',')
+data_trace_files = args.data_trace_file.split(',')
+if len(inst_trace_files) != args.num_cpus or \
+   len(data_trace_files) != args.num_cpus:
+    fatal("Multi-processor trace replay needs a comma separated list of "\
+            "--num-cpus instruction and data trace files.\n")
 
 # In this case FutureClass will be None as there is not fast forwarding or
 # switching
 (CPUClass, test_mem_mode, FutureClass) = Simulation.setCPUClass(args)
 CPUClass.numThreads = numThreads
 
-system = System(cpu = CPUClass(cpu_id=0),
+system = System(cpu = [CPUClass(cpu_id=i) for i in range(args.num_cpus)],
                 mem_mode = test_mem_mode,
                 mem_ranges = [AddrRange(args.mem_size)],
                 cache_line_size = args.cacheline_size)
@@ -103,9 +118,11 @@ for cpu in system.cpu:
 for cpu in system.cpu:
     cpu.createThreads()
 
-# Assign input trace files to the Trace CPU
-system.cpu.instTraceFile=args.inst_trace_file
-system.cpu.dataTraceFile=args.data_trace_file
+# Assign input trace files to the Trace CPUs
+for cpu, inst_trace, data_trace in zip(system.cpu, inst_trace_files,
+                                       data_trace_files):
+    cpu.instTraceFile = inst_trace
+    cpu.dataTraceFile = data_trace
 
 # Configure the classic memory system args
 MemClass = Simulation.setMemClass(args)
@@ -114,5 +131,12 @@ system.system_port = system.membus.slave
 CacheConfig.config_cache(args, system)
 MemConfig.config_mem(args, system)
 
+# Put every Trace CPU on an event queue of its own, the bridges to the memory
+# system must be spliced in after the caches are connected
+if args.cpu_event_queues:
+    CpuConfig.config_event_queues(system.cpu)
+
 root = Root(full_system = False, system = system)
+if args.cpu_event_queues:
+    root.sim_quantum = args.sim_quantum
 Simulation.run(args, root, system, FutureClass)
@@ -212,6 +212,13 @@ def build_test_system(np):
             not args.fast_forward:
             CpuConfig.config_etrace(TestCPUClass, test_sys.cpu, args)
 
+        if args.branch_trace_en:
+            CpuConfig.config_branch_trace(test_sys.cpu)
+
+        if args.pc_profile_insts or args.pc_profile_cycles:
+            CpuConfig.config_pc_profile(test_sys.cpu, args.pc_profile_insts,
+                                        args.pc_profile_cycles)
+
         CacheConfig.config_cache(args, test_sys)
 
         MemConfig.config_mem(args, test_sys)
@@ -229,6 +236,9 @@ def build_test_system(np):
                 obj.eventq_index = 0
             cpu.eventq_index = i + 1
         test_sys.kvm_vm = KvmVM()
+    elif args.cpu_event_queues:
+        # Bridges must be spliced in once the caches are connected.
+        CpuConfig.config_event_queues(test_sys.cpu)
 
     return test_sys
 
@@ -358,6 +368,8 @@ if ObjectList.is_kvm_cpu(TestCPUClass) or \
     # Uses gem5's parallel event queue feature
     # Note: The simulator is quite picky about this number!
     root.sim_quantum = int(1e9) # 1 ms
+elif args.cpu_event_queues:
+    root.sim_quantum = args.sim_quantum
 
 if args.timesync:
     root.time_sync_enable = True
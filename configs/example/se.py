@@ -191,6 +191,15 @@ system.cpu_clk_domain = SrcClockDomain(clock = args.cpu_clock,
 if args.elastic_trace_en:
     CpuConfig.config_etrace(CPUClass, system.cpu, args)
 
+# If branch tracing is enabled, attach the branch trace probe to every cpu
+if args.branch_trace_en:
+    CpuConfig.config_branch_trace(system.cpu)
+
+# If profiling is enabled, attach a sampling profiler to every cpu
+if args.pc_profile_insts or args.pc_profile_cycles:
+    CpuConfig.config_pc_profile(system.cpu, args.pc_profile_insts,
+                                args.pc_profile_cycles)
+
 # All cpus belong to a common cpu_clk_domain, therefore running at a common
 # frequency.
 for cpu in system.cpu:
@@ -133,6 +133,7 @@ def create_system(options, full_system, system, dma_ports, bootmem,
 
         l2_cntrl = L2Cache_Controller(version = i,
                                       L2cache = l2_cache,
+                                      l2_select_num_bits = l2_bits,
                                       transitions_per_cycle = options.ports,
                                       ruby_system = ruby_system)
 
@@ -211,12 +211,21 @@ class Decoder : public InstDecoder
     {
         fpscrLen = fpscr.len;
         fpscrStride = fpscr.stride;
+        updateContext();
     }
 
     void
     setSveLen(uint8_t len)
     {
         sveLen = len;
+        updateContext();
+    }
+
+  protected:
+    void
+    updateContext()
+    {
+        _context = fpscrLen | fpscrStride << 8 | (uint64_t)sveLen << 16;
     }
 };
 
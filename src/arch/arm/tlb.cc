@@ -81,6 +81,7 @@ TLB::TLB(const ArmTLBParams &p)
       isStage2(p.is_stage2), stage2Req(false), stage2DescReq(false), _attr(0),
       directToStage2(false), tableWalker(nullptr), stage2Tlb(nullptr),
       test(nullptr), stats(this),  rangeMRU(1),
+      microTlb(this, p.micro_tlb_size),
       aarch64(false), aarch64EL(EL0), isPriv(false), isSecure(false),
       isHyp(false), asid(0), vmid(0), hcr(0), dacr(0),
       miscRegValid(false), miscRegContext(0), curTranType(NormalTran)
@@ -170,13 +171,25 @@ TLB::lookup(Addr va, uint16_t asn, vmid_t vmid, bool hyp, bool secure,
 
     TlbEntry *retval = NULL;
 
+    auto matches = [&](const TlbEntry &te) {
+        return ignore_asn ?
+            te.match(va, vmid, hyp, secure, target_el, in_host) :
+            te.match(va, asn, vmid, hyp, secure, false, target_el, in_host);
+    };
+
+    // Everything a match depends on besides the address
+    const uint64_t context = asn | (uint64_t(vmid) << 16) |
+        (uint64_t(hyp) << 32) | (uint64_t(secure) << 33) |
+        (uint64_t(ignore_asn) << 34) | (uint64_t(in_host) << 35) |
+        (uint64_t(target_el) << 36);
+
+    if (!functional)
+        retval = microTlb.lookup(va, context, matches);
+
     // Maintaining LRU array
     int x = 0;
     while (retval == NULL && x < size) {
-        if ((!ignore_asn && table[x].match(va, asn, vmid, hyp, secure, false,
-             target_el, in_host)) ||
-            (ignore_asn && table[x].match(va, vmid, hyp, secure, target_el,
-             in_host))) {
+        if (matches(table[x])) {
             // We only move the hit entry ahead when the position is higher
             // than rangeMRU
             if (x > rangeMRU && !functional) {
@@ -188,6 +201,8 @@ TLB::lookup(Addr va, uint16_t asn, vmid_t vmid, bool hyp, bool secure,
             } else {
                 retval = &table[x];
             }
+            if (!functional)
+                microTlb.insert(va, context, retval);
             break;
         }
         ++x;
@@ -285,6 +300,7 @@ TLB::flushAll()
         ++x;
     }
 
+    microTlb.flush();
     stats.flushTlb++;
 }
 
@@ -309,6 +325,7 @@ TLB::flush(const TLBIALL& tlbi_op)
         ++x;
     }
 
+    microTlb.flush();
     stats.flushTlb++;
 }
 
@@ -332,6 +349,7 @@ TLB::flush(const TLBIALLEL &tlbi_op)
         ++x;
     }
 
+    microTlb.flush();
     stats.flushTlb++;
 }
 
@@ -356,6 +374,7 @@ TLB::flush(const TLBIVMALL &tlbi_op)
         ++x;
     }
 
+    microTlb.flush();
     stats.flushTlb++;
 }
 
@@ -381,6 +400,7 @@ TLB::flush(const TLBIALLN &tlbi_op)
         ++x;
     }
 
+    microTlb.flush();
     stats.flushTlb++;
 }
 
@@ -417,6 +437,7 @@ TLB::flush(const TLBIASID &tlbi_op)
         }
         ++x;
     }
+    microTlb.flush();
     stats.flushTlbAsid++;
 }
 
@@ -441,6 +462,7 @@ TLB::_flushMva(Addr mva, uint64_t asn, bool secure_lookup,
 
     bool hyp = target_el == EL2;
 
+    microTlb.flush();
     te = lookup(mva, asn, vmid, hyp, secure_lookup, true, ignore_asn,
                 target_el, in_host, BaseMMU::Read);
     while (te != NULL) {
@@ -45,6 +45,7 @@
 #include "arch/arm/faults.hh"
 #include "arch/arm/pagetable.hh"
 #include "arch/arm/utility.hh"
+#include "arch/generic/micro_tlb.hh"
 #include "arch/generic/tlb.hh"
 #include "base/statistics.hh"
 #include "mem/request.hh"
@@ -204,6 +205,13 @@ class TLB : public BaseTLB
 
     int rangeMRU; //On lookup, only move entries ahead when outside rangeMRU
 
+    /**
+     * Direct-mapped cache of the table slot a lookup last hit in.
+     * Entries move on insertion and on MRU updates, so a cached slot
+     * is only used if it still matches the lookup.
+     */
+    GenericISA::MicroTLB<TlbEntry> microTlb;
+
   public:
     using Params = ArmTLBParams;
     TLB(const Params &p);
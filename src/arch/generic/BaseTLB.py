@@ -34,6 +34,9 @@ class BaseTLB(SimObject):
     cxx_header = "arch/generic/tlb.hh"
     cxx_class = 'gem5::BaseTLB'
 
+    micro_tlb_size = Param.Unsigned(16, "Number of entries in the "
+            "direct-mapped micro-TLB in front of the TLB (0 to disable)")
+
     # Ports to connect with other TLB levels
     cpu_side_ports  = VectorResponsePort("Ports closer to the CPU side")
     slave     = DeprecatedParam(cpu_side_ports,
@@ -43,11 +43,18 @@ class InstDecoder
     size_t _moreBytesSize;
     Addr _pcMask;
 
+    /**
+     * Summary of the decoder state, other than the PC state, that decoding
+     * depends on (e.g., the operating mode). ISAs with such state update
+     * it whenever that state changes.
+     */
+    uint64_t _context;
+
   public:
     template <typename MoreBytesType>
     InstDecoder(MoreBytesType *mb_buf) :
         _moreBytesPtr(mb_buf), _moreBytesSize(sizeof(MoreBytesType)),
-        _pcMask(~mask(floorLog2(_moreBytesSize)))
+        _pcMask(~mask(floorLog2(_moreBytesSize))), _context(0)
     {}
 
     virtual StaticInstPtr fetchRomMicroop(
@@ -56,6 +63,13 @@ class InstDecoder
     void *moreBytesPtr() const { return _moreBytesPtr; }
     size_t moreBytesSize() const { return _moreBytesSize; }
     Addr pcMask() const { return _pcMask; }
+
+    /**
+     * Instructions decoded from the same bytes with the same PC state
+     * and context are identical, so CPU models caching decoded
+     * instructions must not reuse them across contexts.
+     */
+    uint64_t context() const { return _context; }
 };
 
 } // namespace gem5
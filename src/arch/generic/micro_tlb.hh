@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_MICRO_TLB_HH__
+#define __ARCH_GENERIC_MICRO_TLB_HH__
+
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace GenericISA
+{
+
+/** Hit and miss counts of a micro-TLB. */
+struct MicroTLBStats : public statistics::Group
+{
+    MicroTLBStats(statistics::Group *parent)
+      : statistics::Group(parent, "microTLB"),
+        ADD_STAT(hits, statistics::units::Count::get(),
+                 "Number of lookups that hit in the micro-TLB"),
+        ADD_STAT(misses, statistics::units::Count::get(),
+                 "Number of lookups that missed in the micro-TLB"),
+        ADD_STAT(hitRate, statistics::units::Ratio::get(),
+                 "Fraction of lookups that hit in the micro-TLB",
+                 hits / (hits + misses))
+    {
+    }
+
+    statistics::Scalar hits;
+    statistics::Scalar misses;
+    statistics::Formula hitRate;
+};
+
+/**
+ * A small direct-mapped cache of TLB lookups that sits in front of an
+ * ISA TLB's own (associative) lookup. Each slot remembers, for one
+ * (context, virtual page) pair, a pointer to the TLB entry the full
+ * lookup returned. The context is whatever else the owning TLB matches
+ * on, e.g., an ASID and a VMID packed into one value.
+ *
+ * The owning TLB must call invalidate() before it frees or reuses an
+ * entry, and flush() on any operation that may remove many entries at
+ * once, so that a slot never points at a stale entry.
+ *
+ * The hits and misses are counted in a Stats object constructed from
+ * the parent group, which unit tests can replace with plain counters.
+ */
+template <class Entry, class Stats=MicroTLBStats>
+class MicroTLB
+{
+  private:
+    struct Slot
+    {
+        Addr vpn = 0;
+        uint64_t context = 0;
+        Entry *entry = nullptr;
+    };
+
+    std::vector<Slot> slots;
+    Addr mask = 0;
+
+    static constexpr unsigned PageShift = 12;
+
+    Slot &
+    slot(Addr vpn)
+    {
+        return slots[vpn & mask];
+    }
+
+    Stats stats;
+
+  public:
+    MicroTLB(statistics::Group *parent, unsigned size)
+      : slots(size), mask(size - 1), stats(parent)
+    {
+        fatal_if(size && !isPowerOf2(size),
+                 "The micro-TLB size must be a power of 2.\n");
+    }
+
+    bool enabled() const { return !slots.empty(); }
+
+    const Stats &getStats() const { return stats; }
+
+    /**
+     * Look up the entry cached for a virtual address. TLBs whose
+     * entries move around can pass a check that the cached entry
+     * still translates the address; a failed check is a miss.
+     * @return The cached entry, or nullptr on a miss.
+     */
+    template <class Check>
+    Entry *
+    lookup(Addr va, uint64_t context, Check &&check)
+    {
+        if (!enabled())
+            return nullptr;
+        Addr vpn = va >> PageShift;
+        const Slot &s = slot(vpn);
+        if (s.entry && s.vpn == vpn && s.context == context &&
+                check(*s.entry)) {
+            stats.hits++;
+            return s.entry;
+        }
+        stats.misses++;
+        return nullptr;
+    }
+
+    Entry *
+    lookup(Addr va, uint64_t context)
+    {
+        return lookup(va, context, [](const Entry &) { return true; });
+    }
+
+    /** Remember the entry the full lookup returned for an address. */
+    void
+    insert(Addr va, uint64_t context, Entry *entry)
+    {
+        if (!enabled())
+            return;
+        Addr vpn = va >> PageShift;
+        Slot &s = slot(vpn);
+        s.vpn = vpn;
+        s.context = context;
+        s.entry = entry;
+    }
+
+    /**
+     * Drop every slot pointing at an entry. A large page may be cached
+     * under several virtual pages, so all slots are checked.
+     */
+    void
+    invalidate(const Entry *entry)
+    {
+        for (auto &s : slots) {
+            if (s.entry == entry)
+                s.entry = nullptr;
+        }
+    }
+
+    /** Drop every slot. */
+    void
+    flush()
+    {
+        for (auto &s : slots)
+            s.entry = nullptr;
+    }
+};
+
+} // namespace GenericISA
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_MICRO_TLB_HH__
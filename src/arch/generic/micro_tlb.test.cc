@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "arch/generic/micro_tlb.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+struct Entry
+{
+    int id;
+};
+
+/** Plain counters, so that the test does not need the stats framework. */
+struct Counts
+{
+    Counts(statistics::Group *parent) {}
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+typedef GenericISA::MicroTLB<Entry, Counts> MicroTLB;
+
+const Addr PageBytes = 0x1000;
+
+} // anonymous namespace
+
+/** A disabled micro-TLB never caches anything. */
+TEST(MicroTLBTest, Disabled)
+{
+    MicroTLB utlb(nullptr, 0);
+    Entry entry{0};
+
+    EXPECT_FALSE(utlb.enabled());
+    utlb.insert(0x1000, 0, &entry);
+    EXPECT_EQ(utlb.lookup(0x1000, 0), nullptr);
+}
+
+/** An inserted entry is found for any address in its page. */
+TEST(MicroTLBTest, InsertLookup)
+{
+    MicroTLB utlb(nullptr, 4);
+    Entry entry{0};
+
+    EXPECT_EQ(utlb.lookup(0x1234, 0), nullptr);
+    utlb.insert(0x1234, 0, &entry);
+    EXPECT_EQ(utlb.lookup(0x1234, 0), &entry);
+    EXPECT_EQ(utlb.lookup(0x1000, 0), &entry);
+    EXPECT_EQ(utlb.lookup(0x1fff, 0), &entry);
+
+    // Other pages, and the same page in another context, miss
+    EXPECT_EQ(utlb.lookup(0x2000, 0), nullptr);
+    EXPECT_EQ(utlb.lookup(0x1234, 1), nullptr);
+}
+
+/** Every lookup counts as a hit or a miss. */
+TEST(MicroTLBTest, Stats)
+{
+    MicroTLB utlb(nullptr, 4);
+    Entry entry{0};
+
+    utlb.lookup(0x1000, 0);
+    utlb.insert(0x1000, 0, &entry);
+    utlb.lookup(0x1000, 0);
+    utlb.lookup(0x1000, 0);
+    utlb.lookup(0x1000, 0, [](const Entry &) { return false; });
+
+    EXPECT_EQ(utlb.getStats().hits, 2u);
+    EXPECT_EQ(utlb.getStats().misses, 2u);
+}
+
+/** Pages mapping to the same slot replace each other. */
+TEST(MicroTLBTest, Conflict)
+{
+    MicroTLB utlb(nullptr, 4);
+    Entry entry0{0}, entry1{1}, entry2{2};
+
+    utlb.insert(0 * PageBytes, 0, &entry0);
+    utlb.insert(1 * PageBytes, 0, &entry1);
+    EXPECT_EQ(utlb.lookup(0 * PageBytes, 0), &entry0);
+    EXPECT_EQ(utlb.lookup(1 * PageBytes, 0), &entry1);
+
+    utlb.insert(4 * PageBytes, 0, &entry2);
+    EXPECT_EQ(utlb.lookup(0 * PageBytes, 0), nullptr);
+    EXPECT_EQ(utlb.lookup(4 * PageBytes, 0), &entry2);
+    EXPECT_EQ(utlb.lookup(1 * PageBytes, 0), &entry1);
+}
+
+/** A failed check turns a cached entry into a miss. */
+TEST(MicroTLBTest, Check)
+{
+    MicroTLB utlb(nullptr, 4);
+    Entry entry{7};
+
+    utlb.insert(0x1000, 0, &entry);
+    EXPECT_EQ(utlb.lookup(0x1000, 0,
+                          [](const Entry &e) { return e.id == 7; }),
+              &entry);
+    EXPECT_EQ(utlb.lookup(0x1000, 0,
+                          [](const Entry &e) { return e.id != 7; }),
+              nullptr);
+}
+
+/** Invalidating an entry drops every slot pointing at it. */
+TEST(MicroTLBTest, Invalidate)
+{
+    MicroTLB utlb(nullptr, 4);
+    Entry large{0}, other{1};
+
+    // A large page cached under several virtual pages
+    utlb.insert(0 * PageBytes, 0, &large);
+    utlb.insert(1 * PageBytes, 0, &large);
+    utlb.insert(2 * PageBytes, 0, &other);
+
+    utlb.invalidate(&large);
+    EXPECT_EQ(utlb.lookup(0 * PageBytes, 0), nullptr);
+    EXPECT_EQ(utlb.lookup(1 * PageBytes, 0), nullptr);
+    EXPECT_EQ(utlb.lookup(2 * PageBytes, 0), &other);
+}
+
+/** Flushing drops every slot. */
+TEST(MicroTLBTest, Flush)
+{
+    MicroTLB utlb(nullptr, 4);
+    Entry entries[4] = {{0}, {1}, {2}, {3}};
+
+    for (int i = 0; i < 4; i++)
+        utlb.insert(i * PageBytes, 0, &entries[i]);
+    utlb.flush();
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(utlb.lookup(i * PageBytes, 0), nullptr);
+
+    // The micro-TLB still works after a flush
+    utlb.insert(0, 0, &entries[0]);
+    EXPECT_EQ(utlb.lookup(0, 0), &entries[0]);
+}
+
+/** Sizes which are not a power of 2 are rejected. */
+TEST(MicroTLBDeathTest, BadSize)
+{
+    ASSERT_ANY_THROW(MicroTLB(nullptr, 3));
+}
@@ -72,7 +72,8 @@ buildKey(Addr vpn, uint16_t asid)
 
 TLB::TLB(const Params &p) :
     BaseTLB(p), size(p.size), tlb(size),
-    lruSeq(0), stats(this), pma(p.pma_checker),
+    lruSeq(0), microTlb(this, p.micro_tlb_size), stats(this),
+    pma(p.pma_checker),
     pmp(p.pmp)
 {
     for (size_t x = 0; x < size; x++) {
@@ -108,7 +109,14 @@ TLB::evictLRU()
 TlbEntry *
 TLB::lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden)
 {
-    TlbEntry *entry = trie.lookup(buildKey(vpn, asid));
+    // Hidden lookups from insert() and demapPage() bypass the micro-TLB,
+    // so that they neither count in its stats nor fill it.
+    TlbEntry *entry = hidden ? nullptr : microTlb.lookup(vpn, asid);
+    if (!entry) {
+        entry = trie.lookup(buildKey(vpn, asid));
+        if (entry && !hidden)
+            microTlb.insert(vpn, asid, entry);
+    }
 
     if (!hidden) {
         if (entry)
@@ -214,6 +222,7 @@ TLB::remove(size_t idx)
         tlb[idx].size());
 
     assert(tlb[idx].trieHandle);
+    microTlb.invalidate(&tlb[idx]);
     trie.remove(tlb[idx].trieHandle);
     tlb[idx].trieHandle = NULL;
     freeList.push_back(&tlb[idx]);
@@ -34,6 +34,7 @@
 
 #include <list>
 
+#include "arch/generic/micro_tlb.hh"
 #include "arch/generic/tlb.hh"
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/pagetable.hh"
@@ -67,6 +68,9 @@ class TLB : public BaseTLB
     EntryList freeList;         // free entries
     uint64_t lruSeq;
 
+    /** Direct-mapped cache of trie lookups, keyed by ASID and page. */
+    GenericISA::MicroTLB<TlbEntry> microTlb;
+
     Walker *walker;
 
     struct TlbStats : public statistics::Group
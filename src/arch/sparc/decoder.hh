@@ -99,6 +99,7 @@ class Decoder : public InstDecoder
     setContext(RegVal _asi)
     {
         asi = _asi;
+        _context = asi;
     }
 
     void takeOverFrom(Decoder *old) {}
@@ -274,6 +274,7 @@ class Decoder : public InstDecoder
         altAddr = m5Reg.altAddr;
         defAddr = m5Reg.defAddr;
         stack = m5Reg.stack;
+        _context = m5Reg;
 
         AddrCacheMap::iterator amIter = addrCacheMap.find(m5Reg);
         if (amIter != addrCacheMap.end()) {
@@ -304,6 +305,7 @@ class Decoder : public InstDecoder
         altAddr = old->altAddr;
         defAddr = old->defAddr;
         stack = old->stack;
+        _context = old->_context;
     }
 
     void reset() { state = ResetState; }
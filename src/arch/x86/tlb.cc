@@ -64,7 +64,8 @@ namespace X86ISA {
 
 TLB::TLB(const Params &p)
     : BaseTLB(p), configAddress(0), size(p.size),
-      tlb(size), lruSeq(0), m5opRange(p.system->m5opRange()), stats(this)
+      tlb(size), lruSeq(0), microTlb(this, p.micro_tlb_size),
+      m5opRange(p.system->m5opRange()), stats(this)
 {
     if (!size)
         fatal("TLBs must have a non-zero size.\n");
@@ -91,6 +92,7 @@ TLB::evictLRU()
     }
 
     assert(tlb[lru].trieHandle);
+    microTlb.invalidate(&tlb[lru]);
     trie.remove(tlb[lru].trieHandle);
     tlb[lru].trieHandle = NULL;
     freeList.push_back(&tlb[lru]);
@@ -123,7 +125,12 @@ TLB::insert(Addr vpn, const TlbEntry &entry)
 TlbEntry *
 TLB::lookup(Addr va, bool update_lru)
 {
-    TlbEntry *entry = trie.lookup(va);
+    TlbEntry *entry = microTlb.lookup(va, 0);
+    if (!entry) {
+        entry = trie.lookup(va);
+        if (entry)
+            microTlb.insert(va, 0, entry);
+    }
     if (entry && update_lru)
         entry->lruSeq = nextSeq();
     return entry;
@@ -133,6 +140,7 @@ void
 TLB::flushAll()
 {
     DPRINTF(TLB, "Invalidating all entries.\n");
+    microTlb.flush();
     for (unsigned i = 0; i < size; i++) {
         if (tlb[i].trieHandle) {
             trie.remove(tlb[i].trieHandle);
@@ -152,6 +160,7 @@ void
 TLB::flushNonGlobal()
 {
     DPRINTF(TLB, "Invalidating all non global entries.\n");
+    microTlb.flush();
     for (unsigned i = 0; i < size; i++) {
         if (tlb[i].trieHandle && !tlb[i].global) {
             trie.remove(tlb[i].trieHandle);
@@ -166,6 +175,7 @@ TLB::demapPage(Addr va, uint64_t asn)
 {
     TlbEntry *entry = trie.lookup(va);
     if (entry) {
+        microTlb.invalidate(entry);
         trie.remove(entry->trieHandle);
         entry->trieHandle = NULL;
         freeList.push_back(entry);
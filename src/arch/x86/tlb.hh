@@ -41,6 +41,7 @@
 #include <list>
 #include <vector>
 
+#include "arch/generic/micro_tlb.hh"
 #include "arch/generic/tlb.hh"
 #include "arch/x86/pagetable.hh"
 #include "base/trie.hh"
@@ -102,6 +103,9 @@ namespace X86ISA
         TlbEntryTrie trie;
         uint64_t lruSeq;
 
+        /** Direct-mapped cache of trie lookups, keyed by page. */
+        GenericISA::MicroTLB<TlbEntry> microTlb;
+
         AddrRange m5opRange;
 
         struct TlbStats : public statistics::Group
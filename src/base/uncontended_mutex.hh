@@ -91,6 +91,12 @@ class UncontendedMutex
         }
     }
 
+    bool
+    try_lock()
+    {
+        return testAndSet(0, 1);
+    }
+
     void
     unlock()
     {
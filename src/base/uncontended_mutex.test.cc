@@ -88,3 +88,26 @@ TEST(UncontendedMutex, HeavyContention)
     }
     EXPECT_EQ(data, num_of_iter * num_of_thread);
 }
+
+TEST(UncontendedMutex, TryLock)
+{
+    UncontendedMutex m;
+
+    EXPECT_TRUE(m.try_lock());
+    std::thread([&] () { EXPECT_FALSE(m.try_lock()); }).join();
+
+    // A thread waiting for the lock does not let try_lock succeed either
+    bool locked = false;
+    std::thread t([&] () {
+        std::lock_guard<UncontendedMutex> g(m);
+        locked = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(m.try_lock());
+    m.unlock();
+    t.join();
+    EXPECT_TRUE(locked);
+
+    EXPECT_TRUE(m.try_lock());
+    m.unlock();
+}
@@ -44,3 +44,15 @@ class NativeTrace(ExeTracer):
     cxx_class = 'gem5::Trace::NativeTrace'
     cxx_header = 'cpu/nativetrace.hh'
 
+
+class BinInstTracer(InstTracer):
+    type = 'BinInstTracer'
+    cxx_class = 'gem5::Trace::BinInstTracer'
+    cxx_header = 'cpu/bin_inst_trace.hh'
+
+    file_name = Param.String("", "Trace file, <tracer name>.bin.gz if "
+                             "empty, see util/decode_bin_inst_trace.py")
+    buffer_size = Param.MemorySize("1MiB", "Size of the trace buffers")
+    num_buffers = Param.Unsigned(4, "Number of trace buffers waiting to "
+                                 "be written, on top of the one being "
+                                 "filled by each thread context")
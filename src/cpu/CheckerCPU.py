@@ -40,6 +40,12 @@ class CheckerCPU(BaseCPU):
         "Update the checker with the main CPU's state on an error")
     warnOnlyOnLoadError = Param.Bool(True,
         "If a load result is incorrect, only print a warning and do not exit")
+    asyncCheck = Param.Bool(False,
+        "Verify instructions on a separate host thread against a private "
+        "copy of memory")
+    asyncQueueSize = Param.Unsigned(8192,
+        "Number of instructions the CPU may run ahead of the asynchronous "
+        "checker")
 
     def generateDeviceTree(self, state):
         # The CheckerCPU is not a real CPU and shouldn't generate a DTB
@@ -90,6 +90,11 @@ class ActivityRecorder
     /** Returns if the CPU should be active. */
     bool active() { return activityCount; }
 
+    /** Returns if there was activity within the longest latency, i.e.,
+     * if the time buffers may still hold communication in flight.
+     */
+    bool communicating() const;
+
     /** Clears the time buffer and the activity count. */
     void reset();
 
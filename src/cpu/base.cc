@@ -347,17 +347,22 @@ BaseCPU::regProbePoints()
     ppRetiredLoads = pmuProbePoint("RetiredLoads");
     ppRetiredStores = pmuProbePoint("RetiredStores");
     ppRetiredBranches = pmuProbePoint("RetiredBranches");
+    ppRetiredCtrl = new ProbePointArg<RetiredCtrl>(getProbeManager(),
+                                                   "RetiredCtrl");
 
     ppSleeping = new ProbePointArg<bool>(this->getProbeManager(),
                                          "Sleeping");
 }
 
 void
-BaseCPU::probeInstCommit(const StaticInstPtr &inst, Addr pc)
+BaseCPU::probeInstCommit(const StaticInstPtr &inst,
+                         const TheISA::PCState &pc)
 {
-    if (!inst->isMicroop() || inst->isLastMicroop()) {
+    const bool last_op = !inst->isMicroop() || inst->isLastMicroop();
+
+    if (last_op) {
         ppRetiredInsts->notify(1);
-        ppRetiredInstsPC->notify(pc);
+        ppRetiredInstsPC->notify(pc.instAddr());
     }
 
     if (inst->isLoad())
@@ -366,8 +371,17 @@ BaseCPU::probeInstCommit(const StaticInstPtr &inst, Addr pc)
     if (inst->isStore() || inst->isAtomic())
         ppRetiredStores->notify(1);
 
-    if (inst->isControl())
+    if (inst->isControl()) {
         ppRetiredBranches->notify(1);
+
+        if (last_op && ppRetiredCtrl->hasListeners()) {
+            TheISA::PCState next_pc = pc;
+            inst->advancePC(next_pc);
+            ppRetiredCtrl->notify(RetiredCtrl{inst.get(), pc.instAddr(),
+                                              next_pc.instAddr(),
+                                              pc.branching()});
+        }
+    }
 }
 
 BaseCPU::
@@ -51,6 +51,7 @@
 #error Including BaseCPU in a system without CPU support
 #else
 #include "arch/generic/interrupts.hh"
+#include "arch/pcstate.hh"
 #include "base/statistics.hh"
 #include "mem/port_proxy.hh"
 #include "sim/clocked_object.hh"
@@ -459,9 +460,23 @@ class BaseCPU : public ClockedObject
      * instruction.
      *
      * @param inst Instruction that just committed
-     * @param pc PC of the instruction that just committed
+     * @param pc PC state of the instruction that just committed, as left
+     *           by its execution
      */
-    virtual void probeInstCommit(const StaticInstPtr &inst, Addr pc);
+    virtual void probeInstCommit(const StaticInstPtr &inst,
+                                 const TheISA::PCState &pc);
+
+    /** A retired control instruction and where it sent execution. */
+    struct RetiredCtrl
+    {
+        const StaticInst *inst;
+        /** Address of the control instruction */
+        Addr pc;
+        /** Address of the instruction executed after it */
+        Addr target;
+        /** Whether that is not the sequentially next instruction */
+        bool taken;
+    };
 
    protected:
     /**
@@ -492,6 +507,12 @@ class BaseCPU : public ClockedObject
     /** Retired branches (any type) */
     probing::PMUUPtr ppRetiredBranches;
 
+    /**
+     * Retired control instructions, with their outcome. Only the last
+     * microop of a macroop is reported.
+     */
+    ProbePointArg<RetiredCtrl> *ppRetiredCtrl;
+
     /** CPU cycle counter even if any thread Context is suspended*/
     probing::PMUUPtr ppAllCycles;
 
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/bin_inst_trace.hh"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+#include "base/cprintf.hh"
+#include "base/debug.hh"
+#include "base/loader/symtab.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/base.hh"
+#include "cpu/thread_context.hh"
+#include "debug/ExecEnable.hh"
+#include "enums/OpClass.hh"
+#include "sim/core.hh"
+#include "sim/full_system.hh"
+
+namespace gem5
+{
+
+namespace Trace {
+
+using namespace bin_inst_trace;
+
+namespace
+{
+
+template <typename T>
+void
+append(std::vector<uint8_t> &buffer, const T &value)
+{
+    const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+
+void
+appendString(std::vector<uint8_t> &buffer, const std::string &str)
+{
+    buffer.insert(buffer.end(), str.begin(), str.end());
+}
+
+/** Strings are truncated to fit their 16-bit length. */
+uint16_t
+stringLen(const std::string &str)
+{
+    return std::min<size_t>(str.size(), UINT16_MAX);
+}
+
+} // anonymous namespace
+
+void
+BinInstTracerRecord::dump()
+{
+    BinInstTracer::Stream &stream = tracer.getStream(thread);
+
+    const Addr cur_pc = pc.instAddr();
+    InstEntry entry = {};
+    entry.seq = tracer.nextSeq++;
+    entry.when = when;
+    entry.pc = cur_pc;
+    entry.inst = tracer.instId(stream, staticInst, cur_pc);
+    if (macroStaticInst) {
+        entry.macroop = tracer.instId(stream, macroStaticInst, cur_pc);
+        entry.flags |= InstEntry::HasMacroop;
+    }
+    entry.asid = thread->getIsaPtr()->getExecutingAsid();
+    entry.microPC = pc.microPC();
+    if (thread->getIsaPtr()->inUserMode())
+        entry.flags |= InstEntry::UserMode;
+    if (mem_valid) {
+        entry.addr = addr;
+        entry.flags |= InstEntry::MemValid;
+    }
+    if (fetch_seq_valid) {
+        entry.fetchSeq = fetch_seq;
+        entry.flags |= InstEntry::FetchSeqValid;
+    }
+    if (cp_seq_valid) {
+        entry.cpSeq = cp_seq;
+        entry.flags |= InstEntry::CPSeqValid;
+    }
+    if (!predicate)
+        entry.flags |= InstEntry::PredicateFalse;
+    if (faulting)
+        entry.flags |= InstEntry::Faulting;
+    entry.dataStatus = data_status;
+
+    std::string result;
+    switch (data_status) {
+      case DataInvalid:
+        break;
+      case DataVec:
+        result = csprintf("%s", *data.as_vec);
+        break;
+      case DataVecPred:
+        result = csprintf("%s", *data.as_pred);
+        break;
+      default:
+        entry.data = data.as_int;
+        break;
+    }
+
+    const uint16_t result_len = stringLen(result);
+    tracer.reserve(stream, 1 + sizeof(entry) +
+                   (result_len ? 1 + sizeof(result_len) + result_len : 0));
+    stream.buffer.push_back(TagInst);
+    append(stream.buffer, entry);
+    if (result_len) {
+        stream.buffer.push_back(TagResult);
+        append(stream.buffer, result_len);
+        appendString(stream.buffer, result.substr(0, result_len));
+    }
+}
+
+BinInstTracer::BinInstTracer(const Params &params)
+    : InstTracer(params),
+      fileName(simout.resolve(params.file_name.empty() ?
+                              name() + ".bin.gz" : params.file_name)),
+      bufferSize(params.buffer_size), numBuffers(params.num_buffers),
+      nextSeq(0), allocatedBuffers(0), closing(false), file(nullptr)
+{
+    fatal_if(bufferSize < 4096, "%s: buffer_size must be at least 4KiB\n",
+             name());
+
+    // The CPUs drop the records of faulting instructions unless
+    // ExecFaulting is set, as the TarmacTracer, set it so that they are
+    // all recorded. Whether they are printed is up to the decoder.
+    setDebugFlag("ExecFaulting");
+
+    file = gzopen(fileName.c_str(), "wb");
+    fatal_if(!file, "%s: Could not open trace file %s\n", name(), fileName);
+
+    writer = std::thread([this]() { writerMain(); });
+
+    // Flush the buffers before the simulator exits, the tracer may
+    // never be destroyed.
+    registerExitCallback([this]() { close(); });
+}
+
+BinInstTracer::~BinInstTracer()
+{
+    close();
+}
+
+void
+BinInstTracer::startup()
+{
+    // The symbols are only loaded once the workloads are set up.
+    Buffer buffer;
+    FileHeader header = {};
+    header.magic = Magic;
+    header.version = Version;
+    header.tickFrequency = sim_clock::Frequency;
+    header.fullSystem = FullSystem;
+    header.numSymbols = std::distance(loader::debugSymbolTable.begin(),
+                                      loader::debugSymbolTable.end());
+    std::vector<const debug::CompoundFlag *> compound_flags;
+    for (const auto &it: debug::allFlags()) {
+        auto *flag = dynamic_cast<const debug::CompoundFlag *>(it.second);
+        if (flag)
+            compound_flags.push_back(flag);
+    }
+    header.numCompoundFlags = compound_flags.size();
+    append(buffer, header);
+    for (const auto &sym: loader::debugSymbolTable) {
+        const uint16_t len = stringLen(sym.name);
+        append(buffer, uint64_t(sym.address));
+        append(buffer, len);
+        appendString(buffer, sym.name.substr(0, len));
+    }
+    auto append_name = [&buffer](const std::string &name) {
+        const uint16_t len = stringLen(name);
+        append(buffer, len);
+        appendString(buffer, name.substr(0, len));
+    };
+    for (const auto *flag: compound_flags) {
+        append_name(flag->name());
+        append(buffer, uint16_t(flag->kids().size()));
+        for (const auto *kid: flag->kids())
+            append_name(kid->name());
+    }
+
+    std::lock_guard<std::mutex> lock(writerMutex);
+    fullChunks.push_back(Chunk{GlobalStream, std::move(buffer)});
+    writerCV.notify_all();
+}
+
+InstRecord *
+BinInstTracer::getInstRecord(Tick when, ThreadContext *tc,
+        const StaticInstPtr staticInst, TheISA::PCState pc,
+        const StaticInstPtr macroStaticInst)
+{
+    if (!debug::ExecEnable)
+        return NULL;
+
+    return new BinInstTracerRecord(*this, when, tc, staticInst, pc,
+                                   macroStaticInst);
+}
+
+BinInstTracer::Stream &
+BinInstTracer::getStream(ThreadContext *tc)
+{
+    std::lock_guard<std::mutex> lock(streamsMutex);
+    auto it = streams.find(tc);
+    if (it != streams.end())
+        return *it->second;
+
+    auto stream = std::make_unique<Stream>();
+    stream->id = streams.size();
+    stream->buffer.reserve(bufferSize);
+
+    const std::string &cpu_name = tc->getCpuPtr()->name();
+    const uint16_t len = stringLen(cpu_name);
+    stream->buffer.push_back(TagContext);
+    append(stream->buffer, uint16_t(tc->threadId()));
+    append(stream->buffer, len);
+    appendString(stream->buffer, cpu_name.substr(0, len));
+
+    return *(streams[tc] = std::move(stream));
+}
+
+uint32_t
+BinInstTracer::instId(Stream &stream, const StaticInstPtr &inst, Addr pc)
+{
+    auto it = stream.instIds.find(inst.get());
+    if (it != stream.instIds.end())
+        return it->second;
+
+    const uint32_t id = stream.insts.size();
+    stream.instIds.emplace(inst.get(), id);
+    stream.insts.push_back(inst);
+
+    // Static instructions cache their disassembly, so it is the same
+    // for every execution, as printed by the ExeTracer.
+    const std::string disassembly =
+        inst->disassemble(pc, &loader::debugSymbolTable);
+    const std::string op_class = enums::OpClassStrings[inst->opClass()];
+    std::stringstream flags_ss;
+    inst->printFlags(flags_ss, "|");
+    const std::string flags = flags_ss.str();
+
+    InstDef def = {};
+    def.id = id;
+    if (inst->isMicroop())
+        def.flags |= InstDef::Microop;
+    if (inst->isFirstMicroop())
+        def.flags |= InstDef::FirstMicroop;
+    if (inst->isLastMicroop())
+        def.flags |= InstDef::LastMicroop;
+    def.disassemblyLen = stringLen(disassembly);
+    def.opClassLen = stringLen(op_class);
+    def.flagsLen = stringLen(flags);
+
+    reserve(stream, 1 + sizeof(def) + def.disassemblyLen +
+            def.opClassLen + def.flagsLen);
+    stream.buffer.push_back(TagInstDef);
+    append(stream.buffer, def);
+    appendString(stream.buffer, disassembly.substr(0, def.disassemblyLen));
+    appendString(stream.buffer, op_class.substr(0, def.opClassLen));
+    appendString(stream.buffer, flags.substr(0, def.flagsLen));
+
+    return id;
+}
+
+void
+BinInstTracer::reserve(Stream &stream, size_t size)
+{
+    if (stream.buffer.size() + size <= stream.buffer.capacity())
+        return;
+
+    stream.buffer = submit(stream.id, std::move(stream.buffer));
+    // Oversized entries simply grow the buffer.
+    stream.buffer.reserve(std::max(bufferSize, size));
+}
+
+BinInstTracer::Buffer
+BinInstTracer::submit(uint32_t stream, Buffer &&buffer)
+{
+    std::unique_lock<std::mutex> lock(writerMutex);
+    fullChunks.push_back(Chunk{stream, std::move(buffer)});
+    writerCV.notify_all();
+
+    if (freeBuffers.empty() && allocatedBuffers < numBuffers) {
+        ++allocatedBuffers;
+        return Buffer();
+    }
+
+    // Wait for the writer to catch up.
+    writerCV.wait(lock, [this]() { return !freeBuffers.empty(); });
+    Buffer free_buffer = std::move(freeBuffers.back());
+    freeBuffers.pop_back();
+    free_buffer.clear();
+    return free_buffer;
+}
+
+void
+BinInstTracer::writerMain()
+{
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (true) {
+        writerCV.wait(lock, [this]() {
+            return closing || !fullChunks.empty();
+        });
+        if (fullChunks.empty())
+            break;
+
+        Chunk chunk = std::move(fullChunks.front());
+        fullChunks.pop_front();
+        lock.unlock();
+
+        // Compress and write without holding the lock, so the
+        // simulation can keep filling its buffers.
+        ChunkHeader header = {chunk.stream, uint32_t(chunk.buffer.size())};
+        bool failed = gzwrite(file, &header, sizeof(header)) !=
+            sizeof(header);
+        if (!chunk.buffer.empty()) {
+            failed |= gzwrite(file, chunk.buffer.data(),
+                              chunk.buffer.size()) !=
+                int(chunk.buffer.size());
+        }
+        if (failed)
+            warn("%s: Failed writing the trace to %s\n", name(), fileName);
+
+        lock.lock();
+        if (chunk.stream != GlobalStream) {
+            freeBuffers.push_back(std::move(chunk.buffer));
+            writerCV.notify_all();
+        }
+    }
+}
+
+void
+BinInstTracer::close()
+{
+    if (!file)
+        return;
+
+    {
+        std::lock_guard<std::mutex> streams_lock(streamsMutex);
+        std::lock_guard<std::mutex> lock(writerMutex);
+        for (auto &it: streams) {
+            Stream &stream = *it.second;
+            if (!stream.buffer.empty())
+                fullChunks.push_back(Chunk{stream.id,
+                                           std::move(stream.buffer)});
+            stream.buffer.clear();
+        }
+        closing = true;
+        writerCV.notify_all();
+    }
+
+    writer.join();
+    gzclose(file);
+    file = nullptr;
+}
+
+} // namespace Trace
+} // namespace gem5
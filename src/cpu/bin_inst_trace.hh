@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_BIN_INST_TRACE_HH__
+#define __CPU_BIN_INST_TRACE_HH__
+
+#include <zlib.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+#include "params/BinInstTracer.hh"
+#include "sim/insttracer.hh"
+
+namespace gem5
+{
+
+class ThreadContext;
+
+namespace Trace {
+
+class BinInstTracer;
+
+/**
+ * Layout of the binary instruction trace, see
+ * util/decode_bin_inst_trace.py for a decoder.
+ *
+ * The file is a gzip stream of chunks, each made of a ChunkHeader
+ * followed by entries of the stream it belongs to. Every thread
+ * context traced has its own stream, whose chunks are in order in the
+ * file, but may interleave with the chunks of other streams. The
+ * entries of a stream start with a one byte EntryTag. Instructions are
+ * fixed-size records, and refer to the static instructions by an id
+ * defined by an InstDef entry earlier in the stream, so they can be
+ * recorded without formatting anything.
+ *
+ * The chunk of the global stream, written at startup, holds the
+ * FileHeader, the debug symbol table and the compound debug flags, so
+ * that the decoder expands them as gem5 does.
+ */
+namespace bin_inst_trace
+{
+
+constexpr uint32_t Magic = 0x74623567; // "g5bt"
+constexpr uint32_t Version = 2;
+constexpr uint32_t GlobalStream = ~0U;
+
+struct ChunkHeader
+{
+    uint32_t stream;
+    uint32_t size;
+};
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t tickFrequency;
+    uint8_t fullSystem;
+    uint8_t pad[7];
+    uint64_t numSymbols;
+    uint64_t numCompoundFlags;
+    // Followed by numSymbols times: uint64_t address, uint16_t
+    // length, name. Then numCompoundFlags times: uint16_t length,
+    // name, uint16_t number of kids, and for each kid uint16_t length,
+    // name.
+};
+
+enum EntryTag : uint8_t
+{
+    /** The context of the stream: uint16_t thread id, uint16_t length,
+     * CPU name. */
+    TagContext = 0,
+    /** An InstDef. */
+    TagInstDef = 1,
+    /** An InstEntry. */
+    TagInst = 2,
+    /** The result of the previous instruction, formatted:
+     * uint16_t length, text. */
+    TagResult = 3,
+};
+
+/** Definition of a static instruction id. */
+struct InstDef
+{
+    enum Flags : uint8_t
+    {
+        Microop = 1 << 0,
+        FirstMicroop = 1 << 1,
+        LastMicroop = 1 << 2,
+    };
+
+    uint32_t id;
+    uint8_t flags;
+    uint8_t pad;
+    uint16_t disassemblyLen;
+    uint16_t opClassLen;
+    uint16_t flagsLen;
+    // Followed by the disassembly, op class name and flags strings.
+};
+
+/** An executed instruction, the fields of an InstRecord. */
+struct InstEntry
+{
+    enum Flags : uint8_t
+    {
+        UserMode = 1 << 0,
+        MemValid = 1 << 1,
+        FetchSeqValid = 1 << 2,
+        CPSeqValid = 1 << 3,
+        PredicateFalse = 1 << 4,
+        Faulting = 1 << 5,
+        HasMacroop = 1 << 6,
+    };
+
+    /** Order of the instruction in the trace, across streams. */
+    uint64_t seq;
+    uint64_t when;
+    uint64_t pc;
+    uint64_t addr;
+    uint64_t data;
+    uint64_t fetchSeq;
+    uint64_t cpSeq;
+    uint32_t inst;
+    uint32_t macroop;
+    int32_t asid;
+    uint16_t microPC;
+    uint8_t flags;
+    /** InstRecord::DataStatus */
+    uint8_t dataStatus;
+};
+
+static_assert(sizeof(InstEntry) == 72, "Unexpected InstEntry padding");
+
+} // namespace bin_inst_trace
+
+class BinInstTracerRecord : public InstRecord
+{
+  public:
+    BinInstTracerRecord(BinInstTracer &_tracer, Tick _when,
+                        ThreadContext *_thread,
+                        const StaticInstPtr _staticInst,
+                        TheISA::PCState _pc,
+                        const StaticInstPtr _macroStaticInst = NULL)
+        : InstRecord(_when, _thread, _staticInst, _pc, _macroStaticInst),
+          tracer(_tracer)
+    {
+    }
+
+    void dump() override;
+
+  protected:
+    BinInstTracer &tracer;
+};
+
+/**
+ * An instruction tracer that records the same information as the
+ * ExeTracer in a compact binary format, to be rendered offline.
+ *
+ * Records are copied into a buffer per thread context. Full buffers
+ * are handed to a background thread which compresses and writes them,
+ * and are recycled once written. When the writer lags behind, the
+ * simulation waits for a buffer to be recycled, so the memory used
+ * stays bounded.
+ *
+ * Like the ExeTracer, it only records instructions when the ExecEnable
+ * debug flag is set. The formatting flags, e.g., ExecResult or
+ * ExecMicro, are instead options of the decoder, so all the
+ * information is always recorded. This includes faulting instructions,
+ * which the CPUs only trace when ExecFaulting is set, so the tracer
+ * sets it.
+ */
+class BinInstTracer : public InstTracer
+{
+  public:
+    typedef BinInstTracerParams Params;
+    BinInstTracer(const Params &params);
+    ~BinInstTracer();
+
+    void startup() override;
+
+    InstRecord *getInstRecord(Tick when, ThreadContext *tc,
+            const StaticInstPtr staticInst, TheISA::PCState pc,
+            const StaticInstPtr macroStaticInst = NULL) override;
+
+  protected:
+    typedef std::vector<uint8_t> Buffer;
+
+    /** Entries of a thread context, waiting to be written. */
+    struct Stream
+    {
+        uint32_t id;
+        Buffer buffer;
+
+        /** Ids of the static instructions defined in the stream. */
+        std::unordered_map<const StaticInst *, uint32_t> instIds;
+        /** Keeps the static instructions alive, so that their address
+         * is not reused for another one. */
+        std::vector<StaticInstPtr> insts;
+    };
+
+    struct Chunk
+    {
+        uint32_t stream;
+        Buffer buffer;
+    };
+
+    const std::string fileName;
+    const size_t bufferSize;
+    const size_t numBuffers;
+
+    /** Protects the streams map, shared tracers can be used by CPUs
+     * on different event queues. */
+    std::mutex streamsMutex;
+    std::unordered_map<ThreadContext *, std::unique_ptr<Stream>> streams;
+
+    std::atomic<uint64_t> nextSeq;
+
+    /** Protects the chunks handed over to the writer thread. */
+    std::mutex writerMutex;
+    std::condition_variable writerCV;
+    std::deque<Chunk> fullChunks;
+    std::vector<Buffer> freeBuffers;
+    /** Buffers allocated on top of the one filled by each stream. */
+    size_t allocatedBuffers;
+    bool closing;
+
+    gzFile file;
+    std::thread writer;
+
+    Stream &getStream(ThreadContext *tc);
+
+    /** Returns the id of a static instruction, defining it if needed. */
+    uint32_t instId(Stream &stream, const StaticInstPtr &inst, Addr pc);
+
+    /** Makes room for an entry of the given size in a stream. */
+    void reserve(Stream &stream, size_t size);
+
+    /** Hands a buffer to the writer thread and returns an empty one. */
+    Buffer submit(uint32_t stream, Buffer &&buffer);
+
+    void writerMain();
+
+    /** Flushes all the streams and waits for the writer to finish. */
+    void close();
+
+    friend class BinInstTracerRecord;
+};
+
+} // namespace Trace
+} // namespace gem5
+
+#endif // __CPU_BIN_INST_TRACE_HH__
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_CHECKER_CHECK_STREAM_HH__
+#define __CPU_CHECKER_CHECK_STREAM_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+/**
+ * Single-producer, single-consumer ring buffer used to hand records from
+ * the simulation thread to the asynchronous checker thread. Slots are
+ * recycled in place, so any buffers held by a record keep their capacity
+ * and the steady state does not allocate. A slot is only released by the
+ * consumer once it has been completely processed, so an empty stream
+ * means that the consumer has caught up with the producer.
+ */
+template <class T>
+class CheckStream
+{
+  private:
+    std::vector<T> slots;
+    const size_t mask;
+
+    /** Index of the next slot to consume; written by the consumer. */
+    alignas(64) std::atomic<size_t> head;
+    /** Index of the next slot to produce; written by the producer. */
+    alignas(64) std::atomic<size_t> tail;
+
+  public:
+    explicit CheckStream(size_t size)
+        : slots(size_t(1) << ceilLog2(size)), mask(slots.size() - 1),
+          head(0), tail(0)
+    {}
+
+    /**
+     * Get the slot to fill for the next push, waiting for the consumer
+     * if the stream is full.
+     */
+    T &
+    back()
+    {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        while (t - head.load(std::memory_order_acquire) == slots.size())
+            std::this_thread::yield();
+        return slots[t & mask];
+    }
+
+    /** Publish the slot returned by back(). */
+    void
+    push()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_release);
+    }
+
+    /** Get the oldest unconsumed record, or nullptr if there is none. */
+    T *
+    front()
+    {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return nullptr;
+        return &slots[h & mask];
+    }
+
+    /** Release the record returned by front(). */
+    void
+    pop()
+    {
+        head.store(head.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_release);
+    }
+
+    bool
+    empty() const
+    {
+        return head.load(std::memory_order_acquire) ==
+            tail.load(std::memory_order_acquire);
+    }
+
+    /** Wait until the consumer has processed everything pushed so far. */
+    void
+    flush() const
+    {
+        while (!empty())
+            std::this_thread::yield();
+    }
+};
+
+} // namespace gem5
+
+#endif // __CPU_CHECKER_CHECK_STREAM_HH__
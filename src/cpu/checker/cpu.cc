@@ -40,8 +40,11 @@
 
 #include "cpu/checker/cpu.hh"
 
+#include <chrono>
+#include <cstring>
 #include <list>
 #include <string>
+#include <thread>
 
 #include "arch/generic/tlb.hh"
 #include "cpu/base.hh"
@@ -51,6 +54,7 @@
 #include "cpu/utils.hh"
 #include "params/CheckerCPU.hh"
 #include "sim/full_system.hh"
+#include "sim/system.hh"
 
 namespace gem5
 {
@@ -60,13 +64,34 @@ CheckerCPU::init()
 {
     requestorId = systemPtr->getRequestorId(this);
     tc->getIsaPtr()->setThreadContext(tc);
+
+    if (asyncCheck) {
+        // Stats are read and reset by the simulation thread, so let the
+        // checker thread catch up first.
+        statistics::registerDumpCallback([this]() { flushStream(); });
+        statistics::registerResetCallback([this]() { flushStream(); });
+        checkThread = std::thread([this]() { checkMain(); });
+    }
+}
+
+DrainState
+CheckerCPU::drain()
+{
+    flushStream();
+    return DrainState::Drained;
 }
 
 CheckerCPU::CheckerCPU(const Params &p)
     : BaseCPU(p, true),
       zeroReg(params().isa[0]->regClasses().at(IntRegClass).zeroReg()),
       systemPtr(NULL), icachePort(NULL), dcachePort(NULL),
-      tc(NULL), thread(NULL),
+      tc(NULL),
+      asyncCheck(p.asyncCheck),
+      stream(p.asyncCheck ?
+             new CheckStream<CheckRecord>(p.asyncQueueSize) : nullptr),
+      stopCheckThread(false), asyncRecord(nullptr), asyncUpdate(false),
+      checkQueue(name() + ".check_queue"),
+      thread(NULL),
       unverifiedReq(nullptr),
       unverifiedMemData(nullptr)
 {
@@ -91,6 +116,10 @@ CheckerCPU::CheckerCPU(const Params &p)
 
 CheckerCPU::~CheckerCPU()
 {
+    if (checkThread.joinable()) {
+        stopCheckThread = true;
+        checkThread.join();
+    }
 }
 
 void
@@ -170,6 +199,9 @@ CheckerCPU::readMem(Addr addr, uint8_t *data, unsigned size,
 {
     assert(byte_enable.size() == size);
 
+    if (asyncRecord)
+        return readRecordMem(addr, data, size, byte_enable);
+
     Fault fault = NoFault;
     bool checked_flags = false;
     bool flags_match = true;
@@ -254,6 +286,9 @@ CheckerCPU::writeMem(uint8_t *data, unsigned size,
 {
     assert(byte_enable.size() == size);
 
+    if (asyncRecord)
+        return writeRecordMem(data, size, addr, flags, res, byte_enable);
+
     Fault fault = NoFault;
     bool checked_flags = false;
     bool flags_match = true;
@@ -377,4 +412,333 @@ CheckerCPU::dumpAndExit()
     panic("Checker found an error!");
 }
 
+void
+CheckerCPU::snapshotPage(CheckRecord &rec, Addr paddr)
+{
+    const Addr page_addr = paddr & ~(checkPageBytes - 1);
+    if (!streamedPages.insert(page_addr).second)
+        return;
+
+    // Read line by line so that the caches can supply dirty data.
+    rec.hasPage = true;
+    rec.pageAddr = page_addr;
+    rec.page.resize(checkPageBytes);
+    const unsigned line_size = cacheLineSize();
+    for (Addr offset = 0; offset < checkPageBytes; offset += line_size) {
+        auto mem_req = std::make_shared<Request>(
+            page_addr + offset, line_size, 0, requestorId);
+        Packet pkt(mem_req, MemCmd::ReadReq);
+        pkt.dataStatic(rec.page.data() + offset);
+        dcachePort->sendFunctional(&pkt);
+    }
+}
+
+void
+CheckerCPU::checkMain()
+{
+    // The simulation queue belongs to the simulation thread, messages
+    // from this thread use the tick of the record being verified.
+    curEventQueue(&checkQueue);
+
+    unsigned idle = 0;
+    while (true) {
+        CheckRecord *rec = stream->front();
+        if (!rec) {
+            if (stopCheckThread)
+                break;
+            if (++idle < 1024)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            continue;
+        }
+        idle = 0;
+        checkQueue.setCurTick(rec->when);
+
+        if (rec->hasPage) {
+            privatePages[rec->pageAddr].swap(rec->page);
+            rec->hasPage = false;
+        }
+
+        if (rec->update)
+            rec->update();
+        else
+            checkRecord(*rec);
+
+        stream->pop();
+    }
+}
+
+void
+CheckerCPU::checkRecord(CheckRecord &rec)
+{
+    // The StaticInst is kept alive by the stream; copying the pointer
+    // here would race with the simulation thread on its reference count.
+    const StaticInst *si = rec.staticInst.get();
+
+    DPRINTF(Checker, "Processing instruction [sn:%lli] PC:%s.\n",
+            rec.seqNum, rec.pc);
+
+    asyncRecord = &rec;
+    asyncUpdate = false;
+    baseStats.numCycles++;
+
+    // maintain $r0 semantics
+    thread->setIntReg(zeroReg, 0);
+
+    if (rec.pc.instAddr() != thread->instAddr()) {
+        warn("%lli: PCs do not match! Inst: %s, checker: %s",
+             rec.when, rec.pc, thread->pcState());
+        if (changedPC) {
+            warn("%lli: Changed PCs recently, may not be an error",
+                 rec.when);
+        } else {
+            handleError(rec);
+        }
+    }
+    changedPC = false;
+
+    // Instructions are not fetched or decoded again on this thread, so
+    // pick up whatever state the decoder attached to the PC.
+    thread->pcState(rec.pc);
+    numInst++;
+
+    // Traps are taken by the CPU, and the state they change reaches the
+    // checker through the CheckerThreadContext updates that follow.
+    if (rec.faulted) {
+        asyncRecord = nullptr;
+        return;
+    }
+
+    while (!result.empty())
+        result.pop();
+
+    if (si->isUnverifiable() || rec.systemInst) {
+        copyRecordState(rec, si);
+    } else {
+        Fault fault = si->execute(this, nullptr);
+        if (fault != NoFault) {
+            warn("%lli: sn: %lli at PC: %s took a fault in checker "
+                 "but not in driver CPU: %s", rec.when, rec.seqNum,
+                 rec.pc, fault->name());
+            handleError(rec);
+        }
+
+        const int num_results = rec.results.size();
+        for (int i = 0; i < si->numDestRegs() && i < num_results &&
+                 !result.empty(); i++) {
+            InstResult checker_val = result.front();
+            result.pop();
+            if (checker_val == rec.results[i])
+                continue;
+
+            if (checker_val.isScalar()) {
+                warn("%lli: Instruction results (%i) do not match! (Values "
+                     "may not actually be integers) Inst: %#x, checker: %#x",
+                     rec.when, i, rec.results[i].asIntegerNoAssert(),
+                     checker_val.asInteger());
+            }
+            if (si->isLoad() && warnOnlyOnLoadError)
+                setResult(si->destRegIdx(i), rec.results[i]);
+            else
+                handleError(rec);
+        }
+
+        if (rec.nextPC != thread->nextInstAddr()) {
+            warn("%lli: Instruction next PCs do not match! Inst: %#x, "
+                 "checker: %#x", rec.when, rec.nextPC,
+                 thread->nextInstAddr());
+            handleError(rec);
+        }
+
+        if (si->isLoad())
+            ++numLoad;
+
+        // Carry on from the CPU's results after an error.
+        if (asyncUpdate)
+            copyRecordState(rec, si);
+    }
+
+    // The CPU's copies of side effect registers may already have been
+    // changed by younger instructions, so they can't be compared here.
+    while (!miscRegIdxs.empty())
+        miscRegIdxs.pop();
+
+    TheISA::PCState pc = thread->pcState();
+    si->advancePC(pc);
+    thread->pcState(pc);
+
+    asyncRecord = nullptr;
+}
+
+void
+CheckerCPU::setResult(const RegId &idx, const InstResult &res)
+{
+    if (!res.isValid())
+        return;
+
+    switch (idx.classValue()) {
+      case IntRegClass:
+        thread->setIntReg(idx.index(), res.asInteger());
+        break;
+      case FloatRegClass:
+        thread->setFloatReg(idx.index(), res.asInteger());
+        break;
+      case VecRegClass:
+        thread->setVecReg(idx, res.asVector());
+        break;
+      case VecElemClass:
+        thread->setVecElem(idx, res.asVectorElem());
+        break;
+      case CCRegClass:
+        thread->setCCReg(idx.index(), res.asInteger());
+        break;
+      case MiscRegClass:
+        thread->setMiscRegNoEffect(idx.index(), res.asInteger());
+        break;
+      default:
+        panic("Unknown register class: %d", (int)idx.classValue());
+    }
+}
+
+void
+CheckerCPU::copyRecordState(const CheckRecord &rec, const StaticInst *si)
+{
+    const int num_results = rec.results.size();
+    for (int i = 0; i < si->numDestRegs() && i < num_results; i++)
+        setResult(si->destRegIdx(i), rec.results[i]);
+    for (const auto &[misc_reg, val] : rec.miscRegs)
+        thread->setMiscRegNoEffect(misc_reg, val);
+}
+
+void
+CheckerCPU::handleError(const CheckRecord &rec)
+{
+    if (!exitOnError) {
+        if (updateOnError && !asyncUpdate) {
+            warn("%lli: [sn:%lli] results didn't match up, copying them "
+                 "from the main CPU", rec.when, rec.seqNum);
+            asyncUpdate = true;
+        }
+        return;
+    }
+
+    cprintf("Error detected, instruction information:\n");
+    cprintf("PC:%s, nextPC:%#x\n[sn:%lli]\n[tid:%i]\nTick:%lli\n",
+            rec.pc, rec.nextPC, rec.seqNum, rec.tid, rec.when);
+    if (rec.staticInst) {
+        cprintf("Inst:%s\n",
+                rec.staticInst->disassemble(rec.pc.instAddr()));
+    }
+    if (rec.memValid) {
+        cprintf("Mem vaddr:%#x paddr:%#x size:%i%s\n", rec.vaddr,
+                rec.paddr, rec.size,
+                rec.memUncacheable ? " uncacheable" : "");
+    }
+    panic("%lli: Checker found an error at [sn:%lli], checker PC:%s",
+          rec.when, rec.seqNum, thread->pcState());
+}
+
+uint8_t *
+CheckerCPU::privateByte(const CheckRecord &rec, Addr offset)
+{
+    // The physical address is only known for the page of the first byte.
+    const Addr paddr = rec.paddr + offset;
+    const Addr page_addr = paddr & ~(checkPageBytes - 1);
+    if (rec.memUncacheable ||
+        page_addr != (rec.paddr & ~(checkPageBytes - 1))) {
+        return nullptr;
+    }
+
+    auto it = privatePages.find(page_addr);
+    if (it == privatePages.end())
+        return nullptr;
+    return it->second.data() + (paddr - page_addr);
+}
+
+Fault
+CheckerCPU::readRecordMem(Addr addr, uint8_t *data, unsigned size,
+                          const std::vector<bool> &byte_enable)
+{
+    const CheckRecord &rec = *asyncRecord;
+
+    if (!rec.memValid || rec.vaddr != addr || rec.size != size) {
+        warn("%lli: Load address does not match CPU:%#x (%i) "
+             "Checker:%#x (%i)", rec.when, rec.vaddr, rec.size, addr, size);
+        handleError(rec);
+        memset(data, 0, size);
+        return NoFault;
+    }
+
+    bool stale = false;
+    for (unsigned i = 0; i < size; i++) {
+        const uint8_t cpu_byte = i < rec.memData.size() ? rec.memData[i] : 0;
+        uint8_t *mem_byte = byte_enable[i] ? privateByte(rec, i) : nullptr;
+        if (mem_byte && *mem_byte != cpu_byte) {
+            stale = true;
+            if (warnOnlyOnLoadError)
+                *mem_byte = cpu_byte;
+        }
+        data[i] = mem_byte ? *mem_byte : cpu_byte;
+    }
+
+    // Other requestors write memory behind the checker's back, which the
+    // synchronous checker only tolerates as a load result error too.
+    if (stale) {
+        DPRINTF(Checker, "Load [sn:%lli] to %#x does not match the "
+                "private copy of memory\n", rec.seqNum, rec.paddr);
+        if (!warnOnlyOnLoadError) {
+            warn("%lli: Load value does not match memory at %#x",
+                 rec.when, rec.paddr);
+            handleError(rec);
+        }
+    }
+
+    return NoFault;
+}
+
+Fault
+CheckerCPU::writeRecordMem(uint8_t *data, unsigned size, Addr addr,
+                           Request::Flags flags, uint64_t *res,
+                           const std::vector<bool> &byte_enable)
+{
+    const CheckRecord &rec = *asyncRecord;
+    static uint8_t zero_data[64] = {};
+
+    if (!rec.memValid || rec.vaddr != addr || rec.size != size) {
+        warn("%lli: Store address does not match CPU:%#x (%i) "
+             "Checker:%#x (%i)", rec.when, rec.vaddr, rec.size, addr, size);
+        handleError(rec);
+        return NoFault;
+    }
+
+    // The CPU decides whether a store conditional succeeds.
+    if (res && rec.extraDataValid)
+        *res = rec.extraData;
+    const bool performed = rec.extraDataValid ? rec.extraData : true;
+
+    if (flags & Request::STORE_NO_DATA) {
+        assert(!data);
+        assert(sizeof(zero_data) <= size);
+        data = zero_data;
+    }
+
+    if (performed && rec.memData.size() == size &&
+        memcmp(data, rec.memData.data(), size)) {
+        warn("%lli: Store value does not match value sent to memory! "
+             "vaddr: %#x paddr: %#x", rec.when, rec.vaddr, rec.paddr);
+        handleError(rec);
+    }
+
+    if (performed) {
+        for (unsigned i = 0; i < size; i++) {
+            uint8_t *mem_byte = privateByte(rec, i);
+            if (byte_enable[i] && mem_byte)
+                *mem_byte = data[i];
+        }
+    }
+
+    return NoFault;
+}
+
 } // namespace gem5
@@ -42,13 +42,21 @@
 #ifndef __CPU_CHECKER_CPU_HH__
 #define __CPU_CHECKER_CPU_HH__
 
+#include <atomic>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <queue>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "arch/pcstate.hh"
 #include "base/statistics.hh"
 #include "cpu/base.hh"
+#include "cpu/checker/check_stream.hh"
 #include "cpu/exec_context.hh"
 #include "cpu/inst_res.hh"
 #include "cpu/pc_event.hh"
@@ -80,6 +88,14 @@ class Request;
  * Checker's state through any ThreadContext accesses.  This allows the
  * checker to be able to correctly verify instructions, even with
  * external accesses to the ThreadContext that change state.
+ *
+ * With asyncCheck set, the CPU being checked only converts instructions
+ * into self-contained CheckRecords as they would be verified, and a
+ * separate host thread re-executes them against the checker's own
+ * registers and a private copy of the memory they touch. Updates made
+ * through the CheckerThreadContext are queued in the same stream, so they
+ * reach the checker at the same point in program order as they would
+ * synchronously.
  */
 class CheckerCPU : public BaseCPU, public ExecContext
 {
@@ -91,6 +107,7 @@ class CheckerCPU : public BaseCPU, public ExecContext
 
   public:
     void init() override;
+    DrainState drain() override;
 
     PARAMS(CheckerCPU);
     CheckerCPU(const Params &p);
@@ -137,6 +154,160 @@ class CheckerCPU : public BaseCPU, public ExecContext
     // keep them all in a std::queue
     std::queue<InstResult> result;
 
+    /**
+     * Everything the asynchronous checker needs to verify one committed
+     * instruction, or an update to apply to its state. Records are
+     * recycled by the stream, so the vectors keep their capacity.
+     */
+    struct CheckRecord
+    {
+        /** State update mirrored from the thread context, if any. */
+        std::function<void()> update;
+
+        InstSeqNum seqNum;
+        ThreadID tid;
+        /** Tick at which the CPU handed the instruction over. */
+        Tick when;
+        TheISA::PCState pc;
+        Addr nextPC;
+        /**
+         * Only the simulation thread may copy or release this pointer;
+         * the checker thread uses the raw StaticInst.
+         */
+        StaticInstPtr staticInst;
+        bool faulted;
+        std::vector<InstResult> results;
+
+        /**
+         * Whether the instruction accesses system state, and so can't be
+         * re-executed on the checker thread. Its results are applied
+         * instead, along with the misc registers it wrote, as the CPU
+         * had them when it handed the instruction over.
+         */
+        bool systemInst;
+        std::vector<std::pair<RegIndex, RegVal>> miscRegs;
+
+        /** The memory access as performed by the CPU, if any. */
+        bool memValid;
+        bool memUncacheable;
+        Addr vaddr;
+        Addr paddr;
+        unsigned size;
+        bool extraDataValid;
+        uint64_t extraData;
+        std::vector<uint8_t> memData;
+
+        /** Snapshot of a page the stream has not touched before. */
+        bool hasPage;
+        Addr pageAddr;
+        std::vector<uint8_t> page;
+    };
+
+    /**
+     * Granularity of the private memory copy. Accesses only use the
+     * CPU's physical address within the same chunk, which must not be
+     * larger than the smallest page size of the supported ISAs.
+     */
+    static constexpr Addr checkPageBytes = 4096;
+
+    /** Whether instructions are verified on a separate host thread. */
+    const bool asyncCheck;
+
+    std::unique_ptr<CheckStream<CheckRecord>> stream;
+
+    std::thread checkThread;
+    std::atomic<bool> stopCheckThread;
+
+    /** Pages already sent to the checker thread (simulation side). */
+    std::unordered_set<Addr> streamedPages;
+
+    /** The checker's private copy of memory (checker thread side). */
+    std::unordered_map<Addr, std::vector<uint8_t>> privatePages;
+
+    /** Record being verified by the checker thread. */
+    CheckRecord *asyncRecord;
+
+    /**
+     * Whether an error was found in the record being verified, and the
+     * checker's state must be updated from the CPU's once it is done.
+     */
+    bool asyncUpdate;
+
+    /**
+     * Current event queue of the checker thread, which only tracks the
+     * tick of the record being verified for messages. Nothing is ever
+     * scheduled on it.
+     */
+    EventQueue checkQueue;
+
+    /** Read the page containing paddr through the CPU's data port. */
+    void snapshotPage(CheckRecord &rec, Addr paddr);
+
+    /** Main loop of the checker thread. */
+    void checkMain();
+
+    /** Verify a single instruction record on the checker thread. */
+    void checkRecord(CheckRecord &rec);
+
+    /** Write a result from the CPU into a destination register. */
+    void setResult(const RegId &idx, const InstResult &res);
+
+    /** Copy the results and misc registers of a record from the CPU. */
+    void copyRecordState(const CheckRecord &rec, const StaticInst *si);
+
+    /**
+     * Report an error found in a record with enough context to replay,
+     * or schedule an update from the CPU's state like the synchronous
+     * checker.
+     */
+    void handleError(const CheckRecord &rec);
+
+    /** Find the private copy of the byte at rec.paddr + offset. */
+    uint8_t *privateByte(const CheckRecord &rec, Addr offset);
+
+    Fault readRecordMem(Addr addr, uint8_t *data, unsigned size,
+                        const std::vector<bool> &byte_enable);
+    Fault writeRecordMem(uint8_t *data, unsigned size, Addr addr,
+                         Request::Flags flags, uint64_t *res,
+                         const std::vector<bool> &byte_enable);
+
+  public:
+    /** Whether instructions are verified on a separate host thread. */
+    bool isAsync() const { return asyncCheck; }
+
+    /** Wait until the checker thread has verified everything queued. */
+    void
+    flushStream()
+    {
+        if (stream)
+            stream->flush();
+    }
+
+    /**
+     * Apply an update mirrored from the CPU's thread context. In
+     * asynchronous mode it is queued behind the instructions already
+     * streamed, unless it reads state that may change before the checker
+     * thread would get to it, in which case the stream is flushed first.
+     */
+    template <class F>
+    void
+    mirror(F &&update, bool now=false)
+    {
+        if (!asyncCheck || now) {
+            flushStream();
+            update();
+        } else {
+            CheckRecord &rec = stream->back();
+            rec.update = std::forward<F>(update);
+            rec.when = curTick();
+            rec.staticInst = nullptr;
+            rec.hasPage = false;
+            stream->push();
+        }
+    }
+
+  protected:
+
     StaticInstPtr curStaticInst;
     StaticInstPtr curMacroStaticInst;
 
@@ -414,6 +585,11 @@ class CheckerCPU : public BaseCPU, public ExecContext
     RegVal
     readMiscReg(int misc_reg) override
     {
+        // The side effects of misc register accesses may act on objects
+        // shared with the simulation thread, e.g., TLBs or timers, so the
+        // checker thread only accesses its copy of the registers.
+        if (asyncCheck)
+            return thread->readMiscRegNoEffect(misc_reg);
         return thread->readMiscReg(misc_reg);
     }
 
@@ -432,6 +608,8 @@ class CheckerCPU : public BaseCPU, public ExecContext
         DPRINTF(Checker, "Setting misc reg %d with effect to check later\n",
                 misc_reg);
         miscRegIdxs.push(misc_reg);
+        if (asyncCheck)
+            return thread->setMiscRegNoEffect(misc_reg, val);
         return thread->setMiscReg(misc_reg, val);
     }
 
@@ -440,7 +618,7 @@ class CheckerCPU : public BaseCPU, public ExecContext
     {
         const RegId& reg = si->srcRegIdx(idx);
         assert(reg.is(MiscRegClass));
-        return thread->readMiscReg(reg.index());
+        return this->readMiscReg(reg.index());
     }
 
     void
@@ -576,6 +754,9 @@ class Checker : public CheckerCPU
 
     void verify(const DynInstPtr &inst);
 
+    /** Hand an instruction over to the asynchronous checker thread. */
+    void streamInst(const DynInstPtr &inst);
+
     void validateInst(const DynInstPtr &inst);
     void validateExecution(const DynInstPtr &inst);
     void validateState();
@@ -58,6 +58,7 @@
 #include "sim/full_system.hh"
 #include "sim/sim_object.hh"
 #include "sim/stats.hh"
+#include "sim/system.hh"
 
 namespace gem5
 {
@@ -183,6 +184,19 @@ Checker<DynInstPtr>::verify(const DynInstPtr &completed_inst)
     unverifiedInst = inst;
     inst = NULL;
 
+    if (asyncCheck) {
+        while (unverifiedInst) {
+            streamInst(unverifiedInst);
+            if (!instList.empty() && instList.front()->isCompleted()) {
+                unverifiedInst = instList.front();
+                instList.pop_front();
+            } else {
+                unverifiedInst = NULL;
+            }
+        }
+        return;
+    }
+
     auto &decoder = thread->decoder;
     const Addr pc_mask = decoder.pcMask();
 
@@ -431,10 +445,73 @@ Checker<DynInstPtr>::verify(const DynInstPtr &completed_inst)
     unverifiedInst = NULL;
 }
 
+template <class DynInstPtr>
+void
+Checker<DynInstPtr>::streamInst(const DynInstPtr &inst)
+{
+    DPRINTF(Checker, "Streaming instruction [sn:%lli] PC:%s.\n",
+            inst->seqNum, inst->pcState());
+
+    CheckRecord &rec = stream->back();
+    rec.update = nullptr;
+    rec.seqNum = inst->seqNum;
+    rec.tid = inst->threadNumber;
+    rec.when = curTick();
+    rec.faulted = inst->getFault() != NoFault;
+    // Control instructions are re-executed from their decoded PC state,
+    // as executing them has already redirected the CPU's copy.
+    rec.pc = inst->isControl() && !rec.faulted ?
+        inst->pcToVerify : inst->pcState();
+    rec.nextPC = inst->nextInstAddr();
+    rec.staticInst = inst->staticInst;
+
+    rec.results.clear();
+    for (int i = 0; i < inst->numDestRegs(); i++)
+        rec.results.push_back(inst->popResult());
+
+    // System instructions, e.g., writes to TLB maintenance or timer
+    // registers, act on objects shared with this thread, so the checker
+    // thread can't execute them. It takes the misc registers they wrote
+    // from the CPU instead.
+    rec.systemInst = !rec.faulted &&
+        (inst->isSerializing() || inst->isNonSpeculative());
+    rec.miscRegs.clear();
+    if (rec.systemInst) {
+        for (int i = 0; i < inst->numDestRegs(); i++) {
+            const RegId &idx = inst->destRegIdx(i);
+            if (idx.is(MiscRegClass)) {
+                rec.miscRegs.emplace_back(idx.index(),
+                    inst->tcBase()->readMiscRegNoEffect(idx.index()));
+            }
+        }
+    }
+
+    const RequestPtr &req = inst->reqToVerify;
+    rec.memValid = req && !rec.faulted;
+    rec.hasPage = false;
+    rec.memData.clear();
+    if (rec.memValid) {
+        rec.vaddr = req->getVaddr();
+        rec.paddr = req->hasPaddr() ? req->getPaddr() : 0;
+        rec.size = inst->effSize;
+        rec.memUncacheable = !req->hasPaddr() || req->isUncacheable() ||
+            req->isLocalAccess() || !systemPtr->isMemAddr(rec.paddr);
+        rec.extraDataValid = req->extraDataValid();
+        rec.extraData = rec.extraDataValid ? req->getExtraData() : 0;
+        if (inst->memData)
+            rec.memData.assign(inst->memData, inst->memData + rec.size);
+        if (!rec.memUncacheable)
+            snapshotPage(rec, rec.paddr);
+    }
+
+    stream->push();
+}
+
 template <class DynInstPtr>
 void
 Checker<DynInstPtr>::switchOut()
 {
+    flushStream();
     instList.clear();
 }
 
@@ -133,7 +133,7 @@ class CheckerThreadContext : public ThreadContext
     setContextId(ContextID id) override
     {
        actualTC->setContextId(id);
-       checkerTC->setContextId(id);
+       checkerCPU->mirror([=]() { checkerTC->setContextId(id); });
     }
 
     /** Returns this thread's ID number. */
@@ -141,7 +141,7 @@ class CheckerThreadContext : public ThreadContext
     void
     setThreadId(int id) override
     {
-        checkerTC->setThreadId(id);
+        checkerCPU->mirror([=]() { checkerTC->setThreadId(id); });
         actualTC->setThreadId(id);
     }
 
@@ -191,7 +191,7 @@ class CheckerThreadContext : public ThreadContext
     setStatus(Status new_status) override
     {
         actualTC->setStatus(new_status);
-        checkerTC->setStatus(new_status);
+        checkerCPU->mirror([=]() { checkerTC->setStatus(new_status); });
     }
 
     /// Set the status to Active.
@@ -207,7 +207,8 @@ class CheckerThreadContext : public ThreadContext
     takeOverFrom(ThreadContext *oldContext) override
     {
         actualTC->takeOverFrom(oldContext);
-        checkerTC->copyState(oldContext);
+        checkerCPU->mirror([=]() { checkerTC->copyState(oldContext); },
+                           true);
     }
 
     void
@@ -225,14 +226,14 @@ class CheckerThreadContext : public ThreadContext
     copyArchRegs(ThreadContext *tc) override
     {
         actualTC->copyArchRegs(tc);
-        checkerTC->copyArchRegs(tc);
+        checkerCPU->mirror([=]() { checkerTC->copyArchRegs(tc); }, true);
     }
 
     void
     clearArchRegs() override
     {
         actualTC->clearArchRegs();
-        checkerTC->clearArchRegs();
+        checkerCPU->mirror([=]() { checkerTC->clearArchRegs(); });
     }
 
     //
@@ -293,28 +294,28 @@ class CheckerThreadContext : public ThreadContext
     setIntReg(RegIndex reg_idx, RegVal val) override
     {
         actualTC->setIntReg(reg_idx, val);
-        checkerTC->setIntReg(reg_idx, val);
+        checkerCPU->mirror([=]() { checkerTC->setIntReg(reg_idx, val); });
     }
 
     void
     setFloatReg(RegIndex reg_idx, RegVal val) override
     {
         actualTC->setFloatReg(reg_idx, val);
-        checkerTC->setFloatReg(reg_idx, val);
+        checkerCPU->mirror([=]() { checkerTC->setFloatReg(reg_idx, val); });
     }
 
     void
     setVecReg(const RegId& reg, const TheISA::VecRegContainer& val) override
     {
         actualTC->setVecReg(reg, val);
-        checkerTC->setVecReg(reg, val);
+        checkerCPU->mirror([=]() { checkerTC->setVecReg(reg, val); });
     }
 
     void
     setVecElem(const RegId& reg, const TheISA::VecElem& val) override
     {
         actualTC->setVecElem(reg, val);
-        checkerTC->setVecElem(reg, val);
+        checkerCPU->mirror([=]() { checkerTC->setVecElem(reg, val); });
     }
 
     void
@@ -322,14 +323,14 @@ class CheckerThreadContext : public ThreadContext
             const TheISA::VecPredRegContainer& val) override
     {
         actualTC->setVecPredReg(reg, val);
-        checkerTC->setVecPredReg(reg, val);
+        checkerCPU->mirror([=]() { checkerTC->setVecPredReg(reg, val); });
     }
 
     void
     setCCReg(RegIndex reg_idx, RegVal val) override
     {
         actualTC->setCCReg(reg_idx, val);
-        checkerTC->setCCReg(reg_idx, val);
+        checkerCPU->mirror([=]() { checkerTC->setCCReg(reg_idx, val); });
     }
 
     /** Reads this thread's PC state. */
@@ -339,17 +340,19 @@ class CheckerThreadContext : public ThreadContext
     void
     pcState(const TheISA::PCState &val) override
     {
-        DPRINTF(Checker, "Changing PC to %s, old PC %s\n",
-                         val, checkerTC->pcState());
-        checkerTC->pcState(val);
-        checkerCPU->recordPCChange(val);
+        checkerCPU->mirror([=]() {
+            DPRINTF(Checker, "Changing PC to %s, old PC %s\n",
+                             val, checkerTC->pcState());
+            checkerTC->pcState(val);
+            checkerCPU->recordPCChange(val);
+        });
         return actualTC->pcState(val);
     }
 
     void
     setNPC(Addr val)
     {
-        checkerTC->setNPC(val);
+        checkerCPU->mirror([=]() { checkerTC->setNPC(val); });
         actualTC->setNPC(val);
     }
 
@@ -385,7 +388,9 @@ class CheckerThreadContext : public ThreadContext
     {
         DPRINTF(Checker, "Setting misc reg with no effect: %d to both Checker"
                          " and O3..\n", misc_reg);
-        checkerTC->setMiscRegNoEffect(misc_reg, val);
+        checkerCPU->mirror([=]() {
+            checkerTC->setMiscRegNoEffect(misc_reg, val);
+        });
         actualTC->setMiscRegNoEffect(misc_reg, val);
     }
 
@@ -394,7 +399,15 @@ class CheckerThreadContext : public ThreadContext
     {
         DPRINTF(Checker, "Setting misc reg with effect: %d to both Checker"
                          " and O3..\n", misc_reg);
-        checkerTC->setMiscReg(misc_reg, val);
+        if (checkerCPU->isAsync()) {
+            // The effects of the write act on objects shared with the
+            // simulation thread, actualTC takes care of them.
+            checkerCPU->mirror([=]() {
+                checkerTC->setMiscRegNoEffect(misc_reg, val);
+            });
+        } else {
+            checkerTC->setMiscReg(misc_reg, val);
+        }
         actualTC->setMiscReg(misc_reg, val);
     }
 
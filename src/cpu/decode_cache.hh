@@ -29,10 +29,13 @@
 #ifndef __CPU_DECODE_CACHE_HH__
 #define __CPU_DECODE_CACHE_HH__
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "base/bitfield.hh"
 #include "base/compiler.hh"
+#include "base/intmath.hh"
+#include "base/types.hh"
 #include "cpu/static_inst_fwd.hh"
 
 namespace gem5
@@ -46,7 +49,13 @@ namespace decode_cache
 template <typename EMI>
 using InstMap = std::unordered_map<EMI, StaticInstPtr>;
 
-/// A sparse map from an Addr to a Value, stored in page chunks.
+/**
+ * A sparse map from an Addr to a Value, stored in page chunks. The chunks
+ * are found through a radix tree indexed like a page table, fronted by a
+ * small fully associative cache of the most recently used chunks, so the
+ * common case of fetching from a few hot pages costs a short linear scan
+ * and no hashing.
+ */
 template<class Value, Addr CacheChunkShift = 12>
 class AddrMap
 {
@@ -70,25 +79,56 @@ class AddrMap
     {
         Value items[CacheChunkBytes];
     };
-    // A map of cache chunks which allows a sparse mapping.
-    typedef typename std::unordered_map<Addr, CacheChunk *> ChunkMap;
-    typedef typename ChunkMap::iterator ChunkIt;
-    // Mini cache of recent lookups.
-    ChunkIt recent[2];
-    ChunkMap chunkMap;
-
-    /// Update the mini cache of recent lookups.
-    /// @param recentest The most recent result;
-    void
-    update(ChunkIt recentest)
+
+    // Radix tree nodes. Nodes of the last level point to chunks, the
+    // others to the nodes of the next level.
+    static constexpr unsigned LevelBits = 9;
+    static constexpr unsigned Fanout = 1 << LevelBits;
+    static constexpr unsigned Levels =
+        divCeil(sizeof(Addr) * 8 - CacheChunkShift, LevelBits);
+
+    struct Node
     {
-        recent[1] = recent[0];
-        recent[0] = recentest;
+        void *entries[Fanout] = {};
+    };
+    Node root;
+
+    // Mini cache of recent lookups, most recently used first.
+    static constexpr int RecentEntries = 8;
+    struct RecentEntry
+    {
+        Addr chunkAddr = MaxAddr;
+        CacheChunk *chunk = nullptr;
+    };
+    RecentEntry recent[RecentEntries];
+
+    /// Walk the radix tree to the CacheChunk of an address, creating it
+    /// if it doesn't exist.
+    /// @param addr The address to look up.
+    CacheChunk *
+    walk(Addr addr)
+    {
+        const Addr chunk_num = addr >> CacheChunkShift;
+
+        Node *node = &root;
+        for (unsigned level = Levels - 1; level > 0; level--) {
+            void *&entry =
+                node->entries[bits(chunk_num, (level + 1) * LevelBits - 1,
+                                   level * LevelBits)];
+            if (!entry)
+                entry = new Node;
+            node = static_cast<Node *>(entry);
+        }
+
+        void *&entry = node->entries[bits(chunk_num, LevelBits - 1, 0)];
+        if (!entry)
+            entry = new CacheChunk();
+        return static_cast<CacheChunk *>(entry);
     }
 
     /// Attempt to find the CacheChunk which goes with a particular
     /// address. First check the small cache of recent results, then
-    /// actually look in the hash map.
+    /// actually walk the tree.
     /// @param addr The address to look up.
     CacheChunk *
     getChunk(Addr addr)
@@ -96,36 +136,48 @@ class AddrMap
         Addr chunk_addr = chunkStart(addr);
 
         // Check against recent lookups.
-        if (recent[0] != chunkMap.end()) {
-            if (recent[0]->first == chunk_addr)
-                return recent[0]->second;
-            if (recent[1] != chunkMap.end() &&
-                    recent[1]->first == chunk_addr) {
-                update(recent[1]);
-                // recent[1] has just become recent[0].
-                return recent[0]->second;
-            }
+        if (recent[0].chunkAddr == chunk_addr)
+            return recent[0].chunk;
+        int idx = 1;
+        while (idx < RecentEntries - 1 && recent[idx].chunkAddr != chunk_addr)
+            idx++;
+
+        // Use the entry found or replace the least recently used one, and
+        // make it the most recent.
+        RecentEntry entry = recent[idx];
+        if (entry.chunkAddr != chunk_addr) {
+            entry.chunkAddr = chunk_addr;
+            entry.chunk = walk(addr);
         }
+        std::copy_backward(recent, recent + idx, recent + idx + 1);
+        recent[0] = entry;
+        return entry.chunk;
+    }
 
-        // Actually look in the hash_map.
-        ChunkIt it = chunkMap.find(chunk_addr);
-        if (it != chunkMap.end()) {
-            update(it);
-            return it->second;
+    void
+    freeNode(Node *node, unsigned level)
+    {
+        for (void *entry : node->entries) {
+            if (!entry)
+                continue;
+            if (level > 0) {
+                Node *child = static_cast<Node *>(entry);
+                freeNode(child, level - 1);
+                delete child;
+            } else {
+                delete static_cast<CacheChunk *>(entry);
+            }
         }
-
-        // Didn't find an existing chunk, so add a new one.
-        CacheChunk *newChunk = new CacheChunk;
-        typename ChunkMap::value_type to_insert(chunk_addr, newChunk);
-        update(chunkMap.insert(to_insert).first);
-        return newChunk;
     }
 
   public:
-    /// Constructor
-    AddrMap()
+    AddrMap() = default;
+    AddrMap(const AddrMap &) = delete;
+    AddrMap &operator=(const AddrMap &) = delete;
+
+    ~AddrMap()
     {
-        recent[0] = recent[1] = chunkMap.end();
+        freeNode(&root, Levels - 1);
     }
 
     Value &
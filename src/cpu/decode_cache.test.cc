@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu/decode_cache.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/**
+ * A synthetic instruction fetch stream spread over many pages, so that
+ * chunks are evicted from the recent lookups.
+ */
+std::vector<Addr>
+fetchStream(size_t length)
+{
+    std::mt19937_64 rng(1);
+    std::vector<Addr> stream;
+    stream.reserve(length);
+    while (stream.size() < length) {
+        Addr pc = 0x400000 + (rng() % (16 << 20));
+        for (int i = 0; i < 8 && stream.size() < length; i++)
+            stream.push_back(pc++);
+    }
+    return stream;
+}
+
+} // anonymous namespace
+
+/** Entries are per address and start value initialized. */
+TEST(DecodeCacheAddrMapTest, Lookup)
+{
+    decode_cache::AddrMap<int> map;
+
+    EXPECT_EQ(map.lookup(0x1000), 0);
+    map.lookup(0x1000) = 1;
+    map.lookup(0x1001) = 2;
+    map.lookup(0x7fffffffe000) = 3;
+    map.lookup(MaxAddr) = 4;
+
+    EXPECT_EQ(map.lookup(0x1000), 1);
+    EXPECT_EQ(map.lookup(0x1001), 2);
+    EXPECT_EQ(map.lookup(0x2000), 0);
+    EXPECT_EQ(map.lookup(0x7fffffffe000), 3);
+    EXPECT_EQ(map.lookup(MaxAddr), 4);
+    EXPECT_EQ(map.lookup(0), 0);
+}
+
+/** Entries survive being evicted from the recent lookups. */
+TEST(DecodeCacheAddrMapTest, ManyChunks)
+{
+    decode_cache::AddrMap<Addr> map;
+
+    for (Addr page = 0; page < 64; page++)
+        map.lookup(page * 0x100000 + page) = page + 1;
+    for (Addr page = 64; page-- > 0;)
+        EXPECT_EQ(map.lookup(page * 0x100000 + page), page + 1);
+}
+
+/** Lookups agree with a hash map on a large fetch stream. */
+TEST(DecodeCacheAddrMapTest, MatchesHashMap)
+{
+    decode_cache::AddrMap<uint32_t> map;
+    std::unordered_map<Addr, uint32_t> reference;
+
+    for (Addr pc : fetchStream(1 << 16))
+        EXPECT_EQ(++map.lookup(pc), ++reference[pc]) << pc;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Decode cache lookups per second of decode_cache::AddrMap against the
+ * previous hashed implementation, on a synthetic large-footprint fetch
+ * stream. The rates depend on the host, so this is a standalone program
+ * rather than a unit test.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu/decode_cache.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/**
+ * The previous AddrMap implementation, hashing page chunks with a two
+ * entry cache of recent lookups, used as the baseline.
+ */
+template<class Value>
+class HashedAddrMap
+{
+  private:
+    struct CacheChunk
+    {
+        Value items[4096];
+    };
+    typedef typename std::unordered_map<Addr, CacheChunk *> ChunkMap;
+    typename ChunkMap::iterator recent[2];
+    ChunkMap chunkMap;
+
+    CacheChunk *
+    getChunk(Addr addr)
+    {
+        Addr chunk_addr = addr & ~Addr(4095);
+        if (recent[0] != chunkMap.end()) {
+            if (recent[0]->first == chunk_addr)
+                return recent[0]->second;
+            if (recent[1] != chunkMap.end() &&
+                    recent[1]->first == chunk_addr) {
+                std::swap(recent[0], recent[1]);
+                return recent[0]->second;
+            }
+        }
+        auto it = chunkMap.find(chunk_addr);
+        if (it == chunkMap.end())
+            it = chunkMap.emplace(chunk_addr, new CacheChunk()).first;
+        recent[1] = recent[0];
+        recent[0] = it;
+        return it->second;
+    }
+
+  public:
+    HashedAddrMap() { recent[0] = recent[1] = chunkMap.end(); }
+
+    ~HashedAddrMap()
+    {
+        for (auto &chunk : chunkMap)
+            delete chunk.second;
+    }
+
+    Value &lookup(Addr addr) { return getChunk(addr)->items[addr & 4095]; }
+};
+
+/**
+ * A synthetic instruction fetch stream with a large code footprint, as
+ * seen in server workloads: basic blocks of a few instructions in many
+ * functions spread over the text segment and shared libraries, with a
+ * skewed call distribution.
+ */
+std::vector<Addr>
+fetchStream(size_t length)
+{
+    std::mt19937_64 rng(1);
+    const Addr text = 0x400000;
+    const Addr libs = 0x7f0000000000;
+
+    std::vector<Addr> functions;
+    for (int i = 0; i < 2048; i++) {
+        Addr base = i % 4 ? text : libs;
+        functions.push_back(base + (rng() % (16 << 20) & ~Addr(15)));
+    }
+
+    std::geometric_distribution<int> pick(0.005);
+    std::vector<Addr> stream;
+    stream.reserve(length);
+    while (stream.size() < length) {
+        Addr pc = functions[pick(rng) % functions.size()];
+        int insts = 4 + rng() % 28;
+        for (int i = 0; i < insts && stream.size() < length; i++) {
+            stream.push_back(pc);
+            pc += 1 + rng() % 7;
+        }
+    }
+    return stream;
+}
+
+template <class Map>
+double
+lookupRate(const std::vector<Addr> &stream, uint64_t &checksum)
+{
+    Map map;
+    auto start = std::chrono::steady_clock::now();
+    for (Addr pc : stream)
+        checksum += ++map.lookup(pc);
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return stream.size() / elapsed.count();
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    const auto stream = fetchStream(1 << 22);
+
+    uint64_t hashed_sum = 0, radix_sum = 0;
+    double hashed = lookupRate<HashedAddrMap<uint32_t>>(stream, hashed_sum);
+    double radix = lookupRate<decode_cache::AddrMap<uint32_t>>(stream,
+                                                                radix_sum);
+
+    if (hashed_sum != radix_sum) {
+        std::cerr << "Lookup results differ\n";
+        return 1;
+    }
+
+    std::cout << "Hashed chunks: " << hashed / 1e6 << " M lookups/s\n"
+              << "Radix tree: " << radix / 1e6 << " M lookups/s ("
+              << radix / hashed << "x)\n";
+    return 0;
+}
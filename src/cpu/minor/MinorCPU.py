@@ -283,6 +283,10 @@ class MinorCPU(BaseCPU):
 
     enableIdling = Param.Bool(True,
         "Enable cycle skipping when the processor is idle\n");
+    skipFUCycles = Param.Bool(False,
+        "Stop ticking while only the FU pipelines advance, until an"
+        " instruction reaches the end of an FU or an event wakes the"
+        " processor up")
 
     branchPred = Param.BranchPredictor(TournamentBP(
         numThreads = Parent.numThreads), "Branch Predictor")
@@ -349,6 +349,22 @@ class SelfStallingPipeline : public MinorBuffer<ElemType, ReportTraits>
     /** There's data (not a bubble) at the end of the pipe */
     bool isPopable() { return !BubbleTraits::isBubble(front()); }
 
+    /** The number of advances after which the oldest element in the pipe
+     *  reaches its end and stalls it.  0 if the pipe is already stalled
+     *  or is empty */
+    unsigned int
+    advancesBeforeStall() const
+    {
+        if (stalled || occupancy == 0)
+            return 0;
+
+        for (int i = 1; i < this->past; i++) {
+            if (!BubbleTraits::isBubble((*this)[i - this->past]))
+                return i;
+        }
+        return 0;
+    }
+
     /** Try to advance the pipeline.  If we're stalled, don't advance.  If
      *  we're not stalled, advance then check to see if we become stalled
      *  (a non-bubble at the end of the pipe) */
@@ -159,6 +159,8 @@ MinorCPU::wakeup(ThreadID tid)
     if (threads[tid]->status() == ThreadContext::Suspended) {
         threads[tid]->activate();
     }
+
+    pipeline->wakeupFromSkip();
 }
 
 void
@@ -97,7 +97,8 @@ Execute::Execute(const std::string &name_,
             ExecuteThreadInfo(params.executeCommitLimit)),
     interruptPriority(0),
     issuePriority(0),
-    commitPriority(0)
+    commitPriority(0),
+    skippableCycles(0)
 {
     if (commitLimit < 1) {
         fatal("%s: executeCommitLimit must be >= 1 (%d)\n", name_,
@@ -891,7 +892,7 @@ Execute::doInstCommitAccounting(MinorDynInstPtr inst)
     if (inst->traceData)
         inst->traceData->setCPSeq(thread->numOp);
 
-    cpu.probeInstCommit(inst->staticInst, inst->pc.instAddr());
+    cpu.probeInstCommit(inst->staticInst, thread->pcState());
 }
 
 bool
@@ -1515,8 +1516,13 @@ Execute::evaluate()
      * clock cycle */
     std::vector<MinorDynInstPtr> next_issuable_insts;
     bool can_issue_next = false;
+    bool have_pending_work = false;
 
     for (ThreadID tid = 0; tid < cpu.numThreads; tid++) {
+        if (!inputBuffer[tid].empty() ||
+            executeInfo[tid].drainState != NotDraining) {
+            have_pending_work = true;
+        }
         /* Find the next issuable instruction for each thread and see if it can
            be issued */
         if (getInput(tid)) {
@@ -1580,12 +1586,14 @@ Execute::evaluate()
         }
     }
 
+    bool lsq_needs_to_tick = lsq.needsToTick();
+
     DPRINTF(Activity, "Need to tick num issued insts: %s%s%s%s%s%s\n",
        (num_issued != 0 ? " (issued some insts)" : ""),
        (becoming_stalled ? "(becoming stalled)" : "(not becoming stalled)"),
        (can_issue_next ? " (can issued next inst)" : ""),
        (head_inst_might_commit ? "(head inst might commit)" : ""),
-       (lsq.needsToTick() ? " (LSQ needs to tick)" : ""),
+       (lsq_needs_to_tick ? " (LSQ needs to tick)" : ""),
        (interrupted ? " (interrupted)" : ""));
 
     bool need_to_tick =
@@ -1593,7 +1601,7 @@ Execute::evaluate()
        !becoming_stalled || /* Some FU pipelines can still move */
        can_issue_next || /* Can still issue a new inst */
        head_inst_might_commit || /* Could possible commit the next inst */
-       lsq.needsToTick() || /* Must step the dcache port */
+       lsq_needs_to_tick || /* Must step the dcache port */
        interrupted; /* There are pending interrupts */
 
     if (!need_to_tick) {
@@ -1601,6 +1609,32 @@ Execute::evaluate()
             " advanceable FUs\n");
     }
 
+    /* If the only reason to tick is that FU pipelines can still move and
+     *  there is nothing to issue, find how many cycles can pass before an
+     *  instruction reaches the end of an FU pipeline.  Until then, the
+     *  cycles only advance the FUs and can be skipped */
+    skippableCycles = Cycles(0);
+    if (need_to_tick && !have_pending_work && num_issued == 0 &&
+        !can_issue_next && !head_inst_might_commit &&
+        !lsq_needs_to_tick && !interrupted &&
+        branch.isBubble() && inp.outputWire->isBubble())
+    {
+        unsigned int advances = 0;
+        for (unsigned int i = 0; i < numFuncUnits; i++) {
+            unsigned int fu_advances = funcUnits[i]->advancesBeforeStall();
+            if (fu_advances != 0 &&
+                (advances == 0 || fu_advances < advances))
+            {
+                advances = fu_advances;
+            }
+        }
+        if (advances > 1) {
+            skippableCycles = Cycles(advances - 1);
+            DPRINTF(Activity, "Only FUs will advance for the next %d"
+                " cycles\n", skippableCycles);
+        }
+    }
+
     /* Wake up if we need to tick again */
     if (need_to_tick)
         cpu.wakeupOnEvent(Pipeline::ExecuteStageId);
@@ -1614,6 +1648,18 @@ Execute::evaluate()
         inputBuffer[inp.outputWire->threadId].pushTail();
 }
 
+void
+Execute::skipCycles(Cycles cycles)
+{
+    assert(cycles <= skippableCycles);
+
+    for (Cycles i(0); i < cycles; ++i) {
+        for (unsigned int j = 0; j < numFuncUnits; j++)
+            funcUnits[j]->advance();
+    }
+    skippableCycles = Cycles(0);
+}
+
 ThreadID
 Execute::checkInterrupts(BranchData& branch, bool& interrupted)
 {
@@ -214,6 +214,10 @@ class Execute : public Named
     ThreadID issuePriority;
     ThreadID commitPriority;
 
+    /** Number of cycles following the last evaluate in which Execute has
+     *  nothing to do but advance its FU pipelines */
+    Cycles skippableCycles;
+
   protected:
     friend std::ostream &operator <<(std::ostream &os, DrainState state);
 
@@ -361,6 +365,13 @@ class Execute : public Named
     /** Like the drain interface on SimObject */
     unsigned int drain();
     void drainResume();
+
+    /** The number of cycles after the last evaluate which may be skipped
+     *  as only the FU pipelines would advance in them */
+    Cycles getSkippableCycles() const { return skippableCycles; }
+
+    /** Advance the FU pipelines over cycles skipped by the Pipeline */
+    void skipCycles(Cycles cycles);
 };
 
 } // namespace minor
@@ -59,6 +59,7 @@ Pipeline::Pipeline(MinorCPU &cpu_, const MinorCPUParams &params) :
     Ticked(cpu_, &(cpu_.BaseCPU::baseStats.numCycles)),
     cpu(cpu_),
     allow_idling(params.enableIdling),
+    skip_fu_cycles(params.skipFUCycles),
     f1ToF2(cpu.name() + ".f1ToF2", "lines",
         params.fetch1ToFetch2ForwardDelay),
     f2ToF1(cpu.name() + ".f2ToF1", "prediction",
@@ -84,7 +85,11 @@ Pipeline::Pipeline(MinorCPU &cpu_, const MinorCPUParams &params) :
         std::max(params.fetch2ToDecodeForwardDelay,
         std::max(params.decodeToExecuteForwardDelay,
         params.executeBranchDelay)))),
-    needToSignalDrained(false)
+    needToSignalDrained(false),
+    skipping(false),
+    skipStartCycle(0),
+    skipEndEvent([this]{ cpu.wakeupOnEvent(ExecuteStageId); },
+        cpu.name() + ".skipEndEvent")
 {
     if (params.fetch1ToFetch2ForwardDelay < 1) {
         fatal("%s: fetch1ToFetch2ForwardDelay must be >= 1 (%d)\n",
@@ -128,6 +133,9 @@ Pipeline::evaluate()
     /** We tick the CPU to update the BaseCPU cycle counters */
     cpu.tick();
 
+    if (skipping)
+        endSkip();
+
     /* Note that it's important to evaluate the stages in order to allow
      *  'immediate', 0-time-offset TimeBuffer activity to be visible from
      *  later stages to earlier ones in the same cycle */
@@ -151,10 +159,33 @@ Pipeline::evaluate()
     activityRecorder.evaluate();
 
     if (allow_idling) {
+        /* Record which stages have nothing to do in the next cycle */
+        for (int stage = Fetch1StageId; stage < Num_StageId; stage++) {
+            if (!activityRecorder.getStageActive(stage))
+                ++cpu.stats.quiescentStageCycles[stage - Fetch1StageId];
+        }
+
         /* Become idle if we can but are not draining */
         if (!activityRecorder.active() && !needToSignalDrained) {
             DPRINTF(Quiesce, "Suspending as the processor is idle\n");
             stop();
+        } else if (skip_fu_cycles && !needToSignalDrained &&
+            activityRecorder.getActivityCount() == 1 &&
+            activityRecorder.getStageActive(ExecuteStageId) &&
+            execute.getSkippableCycles() > 1)
+        {
+            /* Execute is the only active stage and will do nothing but
+             *  advance its FU pipelines for a while.  Stop ticking until
+             *  an instruction can reach the end of an FU or something
+             *  else wakes the pipeline */
+            Cycles cycles = execute.getSkippableCycles();
+            DPRINTF(Quiesce, "Skipping %d cycles in which only FUs"
+                " advance\n", cycles);
+            stop();
+            skipping = true;
+            skipStartCycle = cpu.curCycle();
+            cpu.schedule(skipEndEvent, cpu.clockEdge(cycles));
+            ++cpu.stats.numIdleSkips;
         }
 
         /* Deactivate all stages.  Note that the stages *could*
@@ -180,6 +211,29 @@ Pipeline::evaluate()
     }
 }
 
+void
+Pipeline::endSkip()
+{
+    /* The pipeline restarts with the cycle after the last one skipped */
+    Cycles skipped = cpu.curCycle() - skipStartCycle - Cycles(1);
+
+    DPRINTF(Quiesce, "Restarting after skipping %d cycles\n", skipped);
+
+    execute.skipCycles(skipped);
+    cpu.stats.skippedCycles += skipped;
+
+    if (skipEndEvent.scheduled())
+        cpu.deschedule(skipEndEvent);
+    skipping = false;
+}
+
+void
+Pipeline::wakeupFromSkip()
+{
+    if (skipping)
+        cpu.wakeupOnEvent(ExecuteStageId);
+}
+
 MinorCPU::MinorCPUPort &
 Pipeline::getInstPort()
 {
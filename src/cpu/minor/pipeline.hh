@@ -78,6 +78,9 @@ class Pipeline : public Ticked
     /** Allow cycles to be skipped when the pipeline is idle */
     bool allow_idling;
 
+    /** Allow cycles to be skipped when only the FU pipelines advance */
+    bool skip_fu_cycles;
+
     Latch<ForwardLineData> f1ToF2;
     Latch<BranchData> f2ToF1;
     Latch<ForwardInstData> f2ToD;
@@ -108,6 +111,20 @@ class Pipeline : public Ticked
     /** True after drain is called but draining isn't complete */
     bool needToSignalDrained;
 
+  protected:
+    /** True while the pipeline is descheduled over cycles in which only
+     *  Execute's FU pipelines would advance */
+    bool skipping;
+
+    /** The cycle in which the current skip started */
+    Cycles skipStartCycle;
+
+    /** Restarts the pipeline at the end of a skip */
+    EventFunctionWrapper skipEndEvent;
+
+    /** Catch up with the cycles skipped over when the pipeline restarts */
+    void endSkip();
+
   public:
     Pipeline(MinorCPU &cpu_, const MinorCPUParams &params);
 
@@ -116,6 +133,11 @@ class Pipeline : public Ticked
      *  after quiesce wakeup */
     void wakeupFetch(ThreadID tid);
 
+    /** Restart the pipeline if it is skipping cycles.  This is needed
+     *  when an interrupt is posted as Execute would otherwise only see it
+     *  at the end of the skip */
+    void wakeupFromSkip();
+
     /** Try to drain the CPU */
     bool drain();
 
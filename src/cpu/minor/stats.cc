@@ -58,6 +58,13 @@ MinorStats::MinorStats(BaseCPU *base_cpu)
     ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
              "Total number of cycles that CPU has spent quiesced or waiting "
              "for an interrupt"),
+    ADD_STAT(quiescentStageCycles, statistics::units::Cycle::get(),
+             "Number of ticked cycles after which a stage had nothing to do"),
+    ADD_STAT(numIdleSkips, statistics::units::Count::get(),
+             "Number of times the pipeline skipped cycles in which only "
+             "functional units advanced"),
+    ADD_STAT(skippedCycles, statistics::units::Cycle::get(),
+             "Number of cycles skipped as only functional units advanced"),
     ADD_STAT(cpi, statistics::units::Rate<
                 statistics::units::Cycle, statistics::units::Count>::get(),
              "CPI: cycles per instruction"),
@@ -69,6 +76,13 @@ MinorStats::MinorStats(BaseCPU *base_cpu)
 {
     quiesceCycles.prereq(quiesceCycles);
 
+    quiescentStageCycles
+        .init(4)
+        .subname(0, "fetch1")
+        .subname(1, "fetch2")
+        .subname(2, "decode")
+        .subname(3, "execute");
+
     cpi.precision(6);
     cpi = base_cpu->baseStats.numCycles / numInsts;
 
@@ -75,6 +75,15 @@ struct MinorStats : public statistics::Group
     /** Number of cycles in quiescent state */
     statistics::Scalar quiesceCycles;
 
+    /** Number of ticked cycles after which each of Fetch1, Fetch2, Decode
+     *  and Execute had nothing to do */
+    statistics::Vector quiescentStageCycles;
+
+    /** Number of times the pipeline skipped cycles in which only the
+     *  Execute FU pipelines advanced, and the total cycles skipped */
+    statistics::Scalar numIdleSkips;
+    statistics::Scalar skippedCycles;
+
     /** CPI/IPC for total cycle counts and macro insts */
     statistics::Formula cpi;
     statistics::Formula ipc;
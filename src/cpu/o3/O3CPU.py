@@ -72,6 +72,8 @@ class O3CPU(BaseCPU):
         return True
 
     activity = Param.Unsigned(0, "Initial count")
+    skipStalls = Param.Bool(False, "Stop ticking while the pipeline is "
+          "stalled until an event, e.g., a cache response, wakes it up")
 
     cacheStorePorts = Param.Unsigned(200, "Cache Ports. "
           "Constrains stores only.")
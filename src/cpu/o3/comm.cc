@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/comm.hh"
+
+#include <algorithm>
+#include <iterator>
+
+#include "cpu/o3/dyn_inst.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+void
+InstsStruct::reset()
+{
+    for (int i = 0; i < size; ++i)
+        insts[i] = nullptr;
+    size = 0;
+}
+
+void
+FetchStruct::reset()
+{
+    InstsStruct::reset();
+    fetchFault = NoFault;
+    fetchFaultSN = 0;
+    clearFetchFault = false;
+}
+
+void
+IEWStruct::reset()
+{
+    InstsStruct::reset();
+    mispredictInst.reset();
+    mispredPC.reset();
+    squashedSeqNum.reset();
+    pc.reset();
+    squash.reset();
+    branchMispredict.reset();
+    branchTaken.reset();
+    includeSquashInst.reset();
+}
+
+void
+TimeStruct::reset()
+{
+    decodeInfo.reset();
+    iewInfo.reset();
+    commitInfo.reset();
+
+    std::fill(std::begin(decodeBlock), std::end(decodeBlock), false);
+    std::fill(std::begin(decodeUnblock), std::end(decodeUnblock), false);
+    std::fill(std::begin(renameBlock), std::end(renameBlock), false);
+    std::fill(std::begin(renameUnblock), std::end(renameUnblock), false);
+    std::fill(std::begin(iewBlock), std::end(iewBlock), false);
+    std::fill(std::begin(iewUnblock), std::end(iewUnblock), false);
+}
+
+} // namespace o3
+} // namespace gem5
@@ -42,6 +42,9 @@
 #ifndef __CPU_O3_COMM_HH__
 #define __CPU_O3_COMM_HH__
 
+#include <cstdint>
+#include <cstring>
+#include <new>
 #include <vector>
 
 #include "arch/pcstate.hh"
@@ -57,55 +60,97 @@ namespace gem5
 namespace o3
 {
 
-/** Struct that defines the information passed from fetch to decode. */
-struct FetchStruct
+/**
+ * Per-thread entries of a time buffer payload. Any non-const access marks
+ * the entry of that thread as written, so that reset() only has to clear
+ * the entries of the threads which touched the slot rather than all
+ * MaxThreads of them. Like the time buffer itself, the entries start out
+ * zeroed and then default constructed.
+ */
+template <class Entry>
+class ThreadComm
+{
+  private:
+    Entry entries[MaxThreads];
+    uint8_t written = 0;
+
+    static_assert(MaxThreads <= 8, "Too many threads for the written mask");
+
+  public:
+    Entry &
+    operator[](ThreadID tid)
+    {
+        written |= 1 << tid;
+        return entries[tid];
+    }
+
+    const Entry &operator[](ThreadID tid) const { return entries[tid]; }
+
+    void
+    reset()
+    {
+        for (ThreadID tid = 0; written; ++tid, written >>= 1) {
+            if (written & 1) {
+                entries[tid].~Entry();
+                std::memset(static_cast<void *>(&entries[tid]), 0,
+                            sizeof(Entry));
+                new (&entries[tid]) Entry;
+            }
+        }
+    }
+};
+
+/**
+ * Instructions passed between two stages. Stages fill the instructions in
+ * order and count them in size, so only those need to be released.
+ */
+struct InstsStruct
 {
     int size;
 
     DynInstPtr insts[MaxWidth];
+
+    void reset();
+};
+
+/** Struct that defines the information passed from fetch to decode. */
+struct FetchStruct : public InstsStruct
+{
     Fault fetchFault;
     InstSeqNum fetchFaultSN;
     bool clearFetchFault;
+
+    void reset();
 };
 
 /** Struct that defines the information passed from decode to rename. */
-struct DecodeStruct
+struct DecodeStruct : public InstsStruct
 {
-    int size;
-
-    DynInstPtr insts[MaxWidth];
 };
 
 /** Struct that defines the information passed from rename to IEW. */
-struct RenameStruct
+struct RenameStruct : public InstsStruct
 {
-    int size;
-
-    DynInstPtr insts[MaxWidth];
 };
 
 /** Struct that defines the information passed from IEW to commit. */
-struct IEWStruct
+struct IEWStruct : public InstsStruct
 {
-    int size;
+    ThreadComm<DynInstPtr> mispredictInst;
+    ThreadComm<Addr> mispredPC;
+    ThreadComm<InstSeqNum> squashedSeqNum;
+    ThreadComm<TheISA::PCState> pc;
 
-    DynInstPtr insts[MaxWidth];
-    DynInstPtr mispredictInst[MaxThreads];
-    Addr mispredPC[MaxThreads];
-    InstSeqNum squashedSeqNum[MaxThreads];
-    TheISA::PCState pc[MaxThreads];
-
-    bool squash[MaxThreads];
-    bool branchMispredict[MaxThreads];
-    bool branchTaken[MaxThreads];
-    bool includeSquashInst[MaxThreads];
+    ThreadComm<bool> squash;
+    ThreadComm<bool> branchMispredict;
+    ThreadComm<bool> branchTaken;
+    ThreadComm<bool> includeSquashInst;
+
+    void reset();
 };
 
-struct IssueStruct
+struct IssueStruct : public InstsStruct
 {
-    int size;
-
-    DynInstPtr insts[MaxWidth];
 };
 
 /** Struct that defines all backwards communication. */
@@ -126,7 +171,7 @@ struct TimeStruct
         bool branchTaken;
     };
 
-    DecodeComm decodeInfo[MaxThreads];
+    ThreadComm<DecodeComm> decodeInfo;
 
     struct RenameComm {};
 
@@ -149,7 +194,7 @@ struct TimeStruct
         bool usedLSQ;
     };
 
-    IewComm iewInfo[MaxThreads];
+    ThreadComm<IewComm> iewInfo;
 
     struct CommitComm
     {
@@ -215,7 +260,7 @@ struct TimeStruct
 
     };
 
-    CommitComm commitInfo[MaxThreads];
+    ThreadComm<CommitComm> commitInfo;
 
     bool decodeBlock[MaxThreads];
     bool decodeUnblock[MaxThreads];
@@ -223,6 +268,8 @@ struct TimeStruct
     bool renameUnblock[MaxThreads];
     bool iewBlock[MaxThreads];
     bool iewUnblock[MaxThreads];
+
+    void reset();
 };
 
 } // namespace o3
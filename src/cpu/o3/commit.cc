@@ -411,6 +411,44 @@ Commit::takeOverFrom()
     rob->takeOverFrom();
 }
 
+bool
+Commit::canSkipCycles()
+{
+    ThreadID tid = activeThreads->front();
+
+    if (commitStatus[tid] != Running && commitStatus[tid] != Idle)
+        return false;
+
+    if (trapSquash[tid] || tcSquash[tid] || interrupt != NoFault ||
+            drainPending || drainImminent)
+        return false;
+
+    if (FullSystem && cpu->checkInterrupts(0))
+        return false;
+
+    // Commit would tell IEW that the ROB became empty
+    if (checkEmptyROB[tid] && rob->isEmpty(tid) &&
+            !iewStage->hasStoresToWB(tid))
+        return false;
+
+    return rob->isEmpty(tid) || !rob->readHeadInst(tid)->readyToCommit();
+}
+
+void
+Commit::skipCycles(Cycles cycles)
+{
+    ThreadID tid = activeThreads->front();
+
+    rob->skipCycles(cycles);
+    stats.numCommittedDist.sample(0, cycles);
+
+    if (!rob->isEmpty(tid) && ppCommitStall->hasListeners()) {
+        const DynInstPtr &inst = rob->readHeadInst(tid);
+        for (Cycles i(0); i < cycles; ++i)
+            ppCommitStall->notify(inst);
+    }
+}
+
 void
 Commit::deactivateThread(ThreadID tid)
 {
@@ -193,6 +193,15 @@ class Commit
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
+    /** Returns if commit is waiting for the head of the ROB to complete
+     * and has no squash, trap or interrupt to handle. Only a single
+     * thread is considered.
+     */
+    bool canSkipCycles();
+
+    /** Accounts the statistics of cycles skipped while stalled. */
+    void skipCycles(Cycles cycles);
+
     /** Deschedules a thread from scheduling */
     void deactivateThread(ThreadID tid);
 
@@ -117,8 +117,14 @@ CPU::CPU(const O3CPUParams &params)
                   params.activity),
 
       globalSeqNum(1),
+      // Slots fit all but unusually wide instructions, enough of them
+      // for a full ROB and fetch queue per slab
+      instPool(new DynInstPool(DynInst::allocSize(32, 16),
+                  params.numROBEntries + params.fetchQueueSize * numThreads)),
       system(params.system),
       lastRunningCycle(curCycle()),
+      skipStalls(params.skipStalls),
+      skippingStall(false),
       cpuStats(this)
 {
     fatal_if(FullSystem && params.numThreads > 1,
@@ -354,6 +360,12 @@ CPU::CPU(const O3CPUParams &params)
     }
 }
 
+CPU::~CPU()
+{
+    // Instructions still referenced release the pool when they go
+    instPool->destroy();
+}
+
 void
 CPU::regProbePoints()
 {
@@ -382,6 +394,9 @@ CPU::CPUStats::CPUStats(CPU *cpu)
       ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
                "Total number of cycles that CPU has spent quiesced or waiting "
                "for an interrupt"),
+      ADD_STAT(skippedStallCycles, statistics::units::Cycle::get(),
+               "Number of cycles the CPU skipped while its pipeline was "
+               "stalled"),
       ADD_STAT(committedInsts, statistics::units::Count::get(),
                "Number of Instructions Simulated"),
       ADD_STAT(committedOps, statistics::units::Count::get(),
@@ -433,6 +448,9 @@ CPU::CPUStats::CPUStats(CPU *cpu)
     quiesceCycles
         .prereq(quiesceCycles);
 
+    skippedStallCycles
+        .prereq(skippedStallCycles);
+
     // Number of Instructions simulated
     // --------------------------------
     // Should probably be in Base CPU but need templated
@@ -505,6 +523,10 @@ CPU::tick()
     assert(!switchedOut());
     assert(drainState() != DrainState::Drained);
 
+    // Whatever woke the CPU up should have ended the stall already
+    if (skippingStall)
+        endStall();
+
     ++baseStats.numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
@@ -544,6 +566,10 @@ CPU::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             cpuStats.timesIdled++;
+        } else if (skipStalls && canSkipCycles()) {
+            DPRINTF(O3CPU, "Pipeline stalled, waiting for an event!\n");
+            lastRunningCycle = curCycle();
+            skippingStall = true;
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -556,6 +582,61 @@ CPU::tick()
     tryDrain();
 }
 
+void
+CPU::preDumpStats()
+{
+    accountStalledCycles();
+
+    BaseCPU::preDumpStats();
+}
+
+bool
+CPU::canSkipCycles()
+{
+    if (numThreads != 1 || activeThreads.size() != 1 ||
+            drainState() != DrainState::Running || removeInstsThisCycle)
+        return false;
+
+    // Anything still in the time buffers will change the stages next cycle
+    if (activityRec.communicating())
+        return false;
+
+    return fetch.canSkipCycles() && decode.canSkipCycles() &&
+        rename.canSkipCycles() && iew.canSkipCycles() &&
+        commit.canSkipCycles();
+}
+
+void
+CPU::skipStalledCycles(Cycles cycles)
+{
+    DPRINTF(O3CPU, "Skipped %llu stalled cycles.\n", cycles);
+
+    baseStats.numCycles += cycles;
+    cpuStats.skippedStallCycles += cycles;
+
+    fetch.skipCycles(cycles);
+    decode.skipCycles(cycles);
+    rename.skipCycles(cycles);
+    iew.skipCycles(cycles);
+    commit.skipCycles(cycles);
+
+    lastRunningCycle += cycles;
+}
+
+void
+CPU::accountStalledCycles()
+{
+    if (skippingStall && curCycle() > lastRunningCycle + 1)
+        skipStalledCycles(Cycles(curCycle() - lastRunningCycle - 1));
+}
+
+void
+CPU::endStall()
+{
+    accountStalledCycles();
+    skippingStall = false;
+}
+
 void
 CPU::init()
 {
@@ -696,6 +777,8 @@ CPU::suspendContext(ThreadID tid)
     DPRINTF(O3CPU,"[tid:%i] Suspending Thread Context.\n", tid);
     assert(!switchedOut());
 
+    endStall();
+
     deactivateThread(tid);
 
     // If this was the last thread then unschedule the tick event.
@@ -717,6 +800,8 @@ CPU::haltContext(ThreadID tid)
     DPRINTF(O3CPU,"[tid:%i] Halt Context called. Deallocating\n", tid);
     assert(!switchedOut());
 
+    endStall();
+
     deactivateThread(tid);
     removeThread(tid);
 
@@ -959,6 +1044,7 @@ CPU::drain()
         return DrainState::Draining;
     } else {
         DPRINTF(Drain, "CPU is already drained\n");
+        endStall();
         if (tickEvent.scheduled())
             deschedule(tickEvent);
 
@@ -1404,6 +1490,9 @@ CPU::microPC(ThreadID tid)
 void
 CPU::squashFromTC(ThreadID tid)
 {
+    if (skippingStall)
+        wakeCPU();
+
     thread[tid]->noSquashFromTC = true;
     commit.generateTCEvent(tid);
 }
@@ -1432,7 +1521,7 @@ CPU::instDone(ThreadID tid, const DynInstPtr &inst)
     thread[tid]->threadStats.numOps++;
     cpuStats.committedOps[tid]++;
 
-    probeInstCommit(inst->staticInst, inst->instAddr());
+    probeInstCommit(inst->staticInst, inst->pcState());
 }
 
 void
@@ -1593,6 +1682,14 @@ CPU::wakeDependents(const DynInstPtr &inst)
 void
 CPU::wakeCPU()
 {
+    if (skippingStall) {
+        DPRINTF(Activity, "Waking up stalled CPU\n");
+        endStall();
+        schedule(tickEvent, curCycle() > lastRunningCycle ?
+                 clockEdge() : clockEdge(Cycles(1)));
+        return;
+    }
+
     if (activityRec.active() || tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
         return;
@@ -1614,6 +1711,10 @@ CPU::wakeCPU()
 void
 CPU::wakeup(ThreadID tid)
 {
+    // A pending interrupt is only noticed by commit when it ticks
+    if (skippingStall)
+        wakeCPU();
+
     if (thread[tid]->status() != gem5::ThreadContext::Suspended)
         return;
 
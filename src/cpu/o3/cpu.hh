@@ -56,6 +56,7 @@
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/commit.hh"
 #include "cpu/o3/decode.hh"
+#include "cpu/o3/dyn_inst_pool.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/fetch.hh"
 #include "cpu/o3/free_list.hh"
@@ -169,6 +170,7 @@ class CPU : public BaseCPU
   public:
     /** Constructs a CPU with the given parameters. */
     CPU(const O3CPUParams &params);
+    ~CPU();
 
     ProbePointArg<PacketPtr> *ppInstAccessComplete;
     ProbePointArg<std::pair<DynInstPtr, PacketPtr> > *ppDataAccessComplete;
@@ -187,11 +189,30 @@ class CPU : public BaseCPU
      */
     void tick();
 
+  private:
+    /**
+     * Returns if no stage can make progress until an event wakes the CPU
+     * up, so that the CPU can stop ticking even though the stages are
+     * active. Only single threaded CPUs are supported.
+     */
+    bool canSkipCycles();
+
+    /** Accounts the per-cycle statistics of skipped cycles. */
+    void skipStalledCycles(Cycles cycles);
+
+    /** Accounts the skipped cycles and resumes ticking normally. */
+    void endStall();
+
+  public:
+
     /** Initialize the CPU */
     void init() override;
 
     void startup() override;
 
+    /** Accounts the cycles skipped while stalled before dumping stats. */
+    void preDumpStats() override;
+
     /** Returns the Number of Active Threads in the CPU */
     int numActiveThreads()
     { return activeThreads.size(); }
@@ -579,6 +600,12 @@ class CPU : public BaseCPU
     /** Wakes the CPU, rescheduling the CPU if it's not already active. */
     void wakeCPU();
 
+    /**
+     * Accounts the cycles the CPU has skipped so far while its pipeline
+     * is stalled, before an event changes the state of a stage.
+     */
+    void accountStalledCycles();
+
     virtual void wakeup(ThreadID tid) override;
 
     /** Gets a free thread id. Use if thread ids change across system. */
@@ -595,6 +622,9 @@ class CPU : public BaseCPU
     /** The global sequence number counter. */
     InstSeqNum globalSeqNum;//[MaxThreads];
 
+    /** Allocator of the dynamic instructions of all threads. */
+    DynInstPool *instPool;
+
     /** Pointer to the checker, which can dynamically verify
      * instruction results at run time.  This can be set to NULL if it
      * is not being used.
@@ -613,6 +643,12 @@ class CPU : public BaseCPU
     /** The cycle that the CPU was last running, used for statistics. */
     Cycles lastRunningCycle;
 
+    /** Whether to stop ticking while the pipeline is stalled. */
+    const bool skipStalls;
+
+    /** Whether the CPU stopped ticking while its pipeline is stalled. */
+    bool skippingStall;
+
     /** The cycle that the CPU was last activated by a new thread*/
     Tick lastActivatedCycle;
 
@@ -671,6 +707,9 @@ class CPU : public BaseCPU
         /** Stat for total number of cycles the CPU spends descheduled due to a
          * quiesce operation or waiting for an interrupt. */
         statistics::Scalar quiesceCycles;
+        /** Stat for total number of cycles the CPU did not tick while its
+         * pipeline was stalled. */
+        statistics::Scalar skippedStallCycles;
         /** Stat for the number of committed instructions per thread. */
         statistics::Vector committedInsts;
         /** Stat for the number of committed ops (including micro ops) per
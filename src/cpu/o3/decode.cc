@@ -214,6 +214,37 @@ Decode::isDrained() const
     return true;
 }
 
+bool
+Decode::canSkipCycles() const
+{
+    ThreadID tid = activeThreads->front();
+
+    if (!insts[tid].empty())
+        return false;
+
+    switch (decodeStatus[tid]) {
+      case Blocked:
+        return checkStall(tid);
+      case Running:
+      case Idle:
+        return skidBuffer[tid].empty() && !checkStall(tid);
+      default:
+        return false;
+    }
+}
+
+void
+Decode::skipCycles(Cycles cycles)
+{
+    ThreadID tid = activeThreads->front();
+
+    if (decodeStatus[tid] == Blocked) {
+        stats.blockedCycles += cycles;
+    } else {
+        stats.idleCycles += cycles;
+    }
+}
+
 bool
 Decode::checkStall(ThreadID tid) const
 {
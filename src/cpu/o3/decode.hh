@@ -131,6 +131,14 @@ class Decode
     /** Takes over from another CPU's thread. */
     void takeOverFrom() { resetStage(); }
 
+    /** Returns if decode has nothing to do until the stall it is in is
+     * resolved. Only a single thread is considered.
+     */
+    bool canSkipCycles() const;
+
+    /** Accounts the statistics of cycles skipped while stalled. */
+    void skipCycles(Cycles cycles);
+
     /** Ticks decode, processing all input signals and decoding as many
      * instructions as possible.
      */
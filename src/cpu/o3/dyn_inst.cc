@@ -42,6 +42,7 @@
 
 #include <algorithm>
 
+#include "base/intmath.hh"
 #include "debug/DynInst.hh"
 #include "debug/IQ.hh"
 #include "debug/O3PipeView.hh"
@@ -52,19 +53,52 @@ namespace gem5
 namespace o3
 {
 
+// The register arrays are placed right after the instruction
+static const size_t RegsOffset = roundUp(sizeof(DynInst),
+                                         alignof(std::max_align_t));
+static_assert(alignof(DynInst) <= alignof(std::max_align_t));
+
+size_t
+DynInst::allocSize(size_t srcs, size_t dests)
+{
+    return RegsOffset + Regs::bytesFor(srcs, dests);
+}
+
+void *
+DynInst::operator new(size_t count, DynInstPool &pool,
+                      const StaticInstPtr &static_inst)
+{
+    assert(count == sizeof(DynInst));
+    return pool.allocate(allocSize(static_inst->numSrcRegs(),
+                                   static_inst->numDestRegs()));
+}
+
+void
+DynInst::operator delete(void *ptr, DynInstPool &pool,
+                         const StaticInstPtr &static_inst)
+{
+    DynInstPool::free(ptr);
+}
+
+void
+DynInst::operator delete(void *ptr)
+{
+    DynInstPool::free(ptr);
+}
+
 DynInst::DynInst(const StaticInstPtr &static_inst,
         const StaticInstPtr &_macroop, TheISA::PCState _pc,
         TheISA::PCState pred_pc, InstSeqNum seq_num, CPU *_cpu)
     : seqNum(seq_num), staticInst(static_inst), cpu(_cpu), pc(_pc),
-      regs(staticInst->numSrcRegs(), staticInst->numDestRegs()),
+      regs(staticInst->numSrcRegs(), staticInst->numDestRegs(),
+           reinterpret_cast<uint8_t *>(this) + RegsOffset),
       predPC(pred_pc), macroop(_macroop)
 {
-    this->regs.init();
-
     status.reset();
 
     instFlags.reset();
-    instFlags[RecordResult] = true;
+    // Only the checker consumes the results
+    instFlags[RecordResult] = cpu && cpu->checker;
     instFlags[Predicate] = true;
     instFlags[MemAccPredicate] = true;
 
@@ -234,6 +268,9 @@ DynInst::execute()
     bool no_squash_from_TC = this->thread->noSquashFromTC;
     this->thread->noSquashFromTC = true;
 
+    if (this->cpu->checker && this->isControl())
+        this->pcToVerify = this->pc;
+
     this->fault = this->staticInst->execute(this, this->traceData);
 
     this->thread->noSquashFromTC = no_squash_from_TC;
@@ -251,6 +288,9 @@ DynInst::initiateAcc()
     bool no_squash_from_TC = this->thread->noSquashFromTC;
     this->thread->noSquashFromTC = true;
 
+    if (this->cpu->checker && this->isControl())
+        this->pcToVerify = this->pc;
+
     this->fault = this->staticInst->initiateAcc(this, this->traceData);
 
     this->thread->noSquashFromTC = no_squash_from_TC;
@@ -57,6 +57,7 @@
 #include "cpu/inst_res.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/cpu.hh"
+#include "cpu/o3/dyn_inst_pool.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/lsq_unit.hh"
 #include "cpu/op_class.hh"
@@ -79,6 +80,20 @@ class DynInst : public ExecContext, public RefCounted
     // The list of instructions iterator type.
     typedef typename std::list<DynInstPtr>::iterator ListIt;
 
+    /**
+     * Instructions are allocated from the CPU's DynInstPool, together
+     * with their per-register arrays which are placed right behind them:
+     * new (pool, static_inst) DynInst(static_inst, ...)
+     */
+    static void *operator new(size_t count, DynInstPool &pool,
+                              const StaticInstPtr &static_inst);
+    static void operator delete(void *ptr, DynInstPool &pool,
+                                const StaticInstPtr &static_inst);
+    static void operator delete(void *ptr);
+
+    /** Bytes of an instruction, including its register arrays. */
+    static size_t allocSize(size_t srcs, size_t dests);
+
     /** BaseDynInst constructor given a binary instruction. */
     DynInst(const StaticInstPtr &staticInst, const StaticInstPtr
             &macroop, TheISA::PCState pc, TheISA::PCState predPC,
@@ -177,9 +192,10 @@ class DynInst : public ExecContext, public RefCounted
 
   protected:
     /** The result of the instruction; assumes an instruction can have many
-     *  destination registers.
+     *  destination registers. Results are only recorded for the checker,
+     *  a list does not allocate anything until then.
      */
-    std::queue<InstResult> instResult;
+    std::queue<InstResult, std::list<InstResult>> instResult;
 
     /** PC state for this instruction. */
     TheISA::PCState pc;
@@ -196,9 +212,9 @@ class DynInst : public ExecContext, public RefCounted
     /**
      * Collect register related information into a single struct. The number of
      * source and destination registers can vary, and storage for information
-     * about them needs to be allocated dynamically. This class figures out
-     * how much space is needed and allocates it all at once, and then
-     * trivially divies it up for each type of per-register array.
+     * about them is allocated along with the instruction. This class figures
+     * out how much space is needed, and then trivially divies it up for each
+     * type of per-register array.
      */
     struct Regs
     {
@@ -206,10 +222,7 @@ class DynInst : public ExecContext, public RefCounted
         size_t _numSrcs;
         size_t _numDests;
 
-        using BackingStorePtr = std::unique_ptr<uint8_t[]>;
-        using BufCursor = BackingStorePtr::pointer;
-
-        BackingStorePtr buf;
+        using BufCursor = uint8_t *;
 
         // Members should be ordered based on required alignment so that they
         // can be allocated contiguously.
@@ -254,6 +267,12 @@ class DynInst : public ExecContext, public RefCounted
         }
 
       public:
+        static size_t
+        bytesFor(size_t srcs, size_t dests)
+        {
+            return bytesForSources(srcs) + bytesForDests(dests);
+        }
+
         size_t numSrcs() const { return _numSrcs; }
         size_t numDests() const { return _numDests; }
 
@@ -263,10 +282,9 @@ class DynInst : public ExecContext, public RefCounted
             std::fill(_readySrcIdx, _readySrcIdx + (numSrcs() + 7) / 8, 0);
         }
 
-        Regs(size_t srcs, size_t dests) : _numSrcs(srcs), _numDests(dests),
-            buf(new uint8_t[bytesForSources(srcs) + bytesForDests(dests)])
+        Regs(size_t srcs, size_t dests, BufCursor cur)
+            : _numSrcs(srcs), _numDests(dests)
         {
-            BufCursor cur = buf.get();
             allocate(_flatDestIdx, cur, dests);
             allocate(_destIdx, cur, dests);
             allocate(_prevDestIdx, cur, dests);
@@ -406,9 +424,14 @@ class DynInst : public ExecContext, public RefCounted
     // Need a copy of main request pointer to verify on writes.
     RequestPtr reqToVerify;
 
+    // PC state of a control instruction before executing it, so that an
+    // asynchronous checker can re-execute it from the decoded state.
+    TheISA::PCState pcToVerify;
+
   public:
     /** Records changes to result? */
     void recordResult(bool f) { instFlags[RecordResult] = f; }
+    bool recordingResult() const { return instFlags[RecordResult]; }
 
     /** Is the effective virtual address valid. */
     bool effAddrValid() const { return instFlags[EffAddrValid]; }
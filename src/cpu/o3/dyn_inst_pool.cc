@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/dyn_inst_pool.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+DynInstPool::DynInstPool(size_t slot_size, size_t slab_slots)
+    : _slotSize(roundUp(slot_size, sizeof(Header))),
+      slabSlots(std::max<size_t>(slab_slots, 1)), freeList(nullptr),
+      outstanding(0), destroyed(false)
+{
+    grow();
+}
+
+void
+DynInstPool::grow()
+{
+    const size_t stride = (sizeof(Header) + _slotSize) / sizeof(Header);
+    slabs.emplace_back(new Header[stride * slabSlots]);
+
+    Header *slab = slabs.back().get();
+    for (size_t i = slabSlots; i-- > 0;) {
+        Header *header = slab + i * stride;
+        header->pool = this;
+        header->next = freeList;
+        freeList = header;
+    }
+}
+
+void *
+DynInstPool::allocate(size_t size)
+{
+    Header *header;
+    if (size <= _slotSize) {
+        if (!freeList)
+            grow();
+        header = freeList;
+        freeList = header->next;
+        outstanding++;
+    } else {
+        header = static_cast<Header *>(
+                ::operator new(sizeof(Header) + size));
+        header->pool = nullptr;
+    }
+    return header + 1;
+}
+
+void
+DynInstPool::free(void *ptr)
+{
+    Header *header = static_cast<Header *>(ptr) - 1;
+    DynInstPool *pool = header->pool;
+    if (!pool) {
+        ::operator delete(header);
+        return;
+    }
+
+    header->next = pool->freeList;
+    pool->freeList = header;
+    assert(pool->outstanding);
+    if (--pool->outstanding == 0 && pool->destroyed)
+        delete pool;
+}
+
+void
+DynInstPool::destroy()
+{
+    destroyed = true;
+    if (outstanding == 0)
+        delete this;
+}
+
+} // namespace o3
+} // namespace gem5
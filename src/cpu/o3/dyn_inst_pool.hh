@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_DYN_INST_POOL_HH__
+#define __CPU_O3_DYN_INST_POOL_HH__
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Slab allocator for the dynamic instructions of a CPU. Instructions are
+ * created for every fetched micro-op and destroyed in bulk on squashes,
+ * so the pool keeps freed slots on a free list and reuses them instead
+ * of going through malloc. Slots are carved out of slabs sized for the
+ * instructions the CPU can have in flight; the pool grows by another
+ * slab if they are all in use. Requests larger than a slot fall back to
+ * the heap.
+ *
+ * Every allocation is preceded by a header pointing back to its pool, so
+ * it can be freed without knowing where it came from. Instructions may
+ * outlive the CPU (e.g., when held by a probe listener), so the pool is
+ * only deleted once its owner destroyed it and all its slots are free.
+ */
+class DynInstPool
+{
+  public:
+    /**
+     * @param slot_size Size of the allocations served from the slabs.
+     * @param slab_slots Number of slots of each slab.
+     */
+    DynInstPool(size_t slot_size, size_t slab_slots);
+
+    DynInstPool(const DynInstPool &) = delete;
+    DynInstPool &operator=(const DynInstPool &) = delete;
+
+    void *allocate(size_t size);
+
+    /** Return an allocation to the pool it came from. */
+    static void free(void *ptr);
+
+    /** Release the pool once no allocation is outstanding anymore. */
+    void destroy();
+
+    size_t slotSize() const { return _slotSize; }
+
+  private:
+    ~DynInstPool() = default;
+
+    struct alignas(std::max_align_t) Header
+    {
+        /** The owning pool, or nullptr for heap allocations. */
+        DynInstPool *pool;
+        /** Next free slot while on the free list. */
+        Header *next;
+    };
+
+    void grow();
+
+    const size_t _slotSize;
+    const size_t slabSlots;
+
+    std::vector<std::unique_ptr<Header[]>> slabs;
+    Header *freeList;
+
+    size_t outstanding;
+    bool destroyed;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_DYN_INST_POOL_HH__
@@ -473,6 +473,65 @@ Fetch::wakeFromQuiesce()
     fetchStatus[0] = Running;
 }
 
+bool
+Fetch::canSkipCycles()
+{
+    if (interruptPending)
+        return false;
+
+    ThreadID tid = activeThreads->front();
+
+    // Instructions in the fetch queue would go to decode
+    if (!fetchQueue[tid].empty() && !stalls[tid].decode)
+        return false;
+
+    switch (fetchStatus[tid]) {
+      case Running:
+        {
+            // A full fetch queue stops fetch, unless it has to access
+            // the I-cache for the current or the next fetch buffer.
+            if (fetchQueue[tid].size() < fetchQueueSize)
+                return false;
+            if (macroop[tid])
+                return true;
+            Addr fetch_addr = (pc[tid].instAddr() + fetchOffset[tid]) &
+                decoder[tid]->pcMask();
+            return fetchBufferValid[tid] &&
+                fetchBufferAlignPC(fetch_addr) == fetchBufferPC[tid];
+        }
+      case Idle:
+      case IcacheWaitResponse:
+      case IcacheWaitRetry:
+      case ItlbWait:
+      case TrapPending:
+      case QuiescePending:
+      case NoGoodAddr:
+        return true;
+      default:
+        return false;
+    }
+}
+
+void
+Fetch::skipCycles(Cycles cycles)
+{
+    ThreadID tid = activeThreads->front();
+
+    if (fetchStatus[tid] == Running) {
+        fetchStats.cycles += cycles;
+    } else if (fetchStatus[tid] == Idle) {
+        fetchStats.idleCycles += cycles;
+    } else {
+        profileStall(tid, cycles);
+    }
+
+    fetchStats.nisnDist.sample(0, cycles);
+
+    // Keep the random number stream as if fetch had ticked
+    for (Cycles i(0); i < cycles; ++i)
+        random_mt.random<uint8_t>(0, activeThreads->size() - 1);
+}
+
 void
 Fetch::switchToActive()
 {
@@ -1051,8 +1110,8 @@ Fetch::buildInst(ThreadID tid, StaticInstPtr staticInst,
     InstSeqNum seq = cpu->getAndIncrementInstSeq();
 
     // Create a new DynInst from the instruction fetched.
-    DynInstPtr instruction =
-        new DynInst(staticInst, curMacroop, thisPC, nextPC, seq, cpu);
+    DynInstPtr instruction = new (*cpu->instPool, staticInst)
+        DynInst(staticInst, curMacroop, thisPC, nextPC, seq, cpu);
     instruction->setTid(tid);
 
     instruction->setThreadState(cpu->thread[tid]);
@@ -1358,6 +1417,9 @@ Fetch::fetch(bool &status_change)
 void
 Fetch::recvReqRetry()
 {
+    // The retry changes the reason fetch is stalled for
+    cpu->accountStalledCycles();
+
     if (retryPkt != NULL) {
         assert(cacheBlocked);
         assert(retryTid != InvalidThreadID);
@@ -1557,42 +1619,42 @@ Fetch::pipelineIcacheAccesses(ThreadID tid)
 }
 
 void
-Fetch::profileStall(ThreadID tid)
+Fetch::profileStall(ThreadID tid, Cycles cycles)
 {
     DPRINTF(Fetch,"There are no more threads available to fetch from.\n");
 
     // @todo Per-thread stats
 
     if (stalls[tid].drain) {
-        ++fetchStats.pendingDrainCycles;
+        fetchStats.pendingDrainCycles += cycles;
         DPRINTF(Fetch, "Fetch is waiting for a drain!\n");
     } else if (activeThreads->empty()) {
-        ++fetchStats.noActiveThreadStallCycles;
+        fetchStats.noActiveThreadStallCycles += cycles;
         DPRINTF(Fetch, "Fetch has no active thread!\n");
     } else if (fetchStatus[tid] == Blocked) {
-        ++fetchStats.blockedCycles;
+        fetchStats.blockedCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is blocked!\n", tid);
     } else if (fetchStatus[tid] == Squashing) {
-        ++fetchStats.squashCycles;
+        fetchStats.squashCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is squashing!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitResponse) {
-        ++fetchStats.icacheStallCycles;
+        fetchStats.icacheStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting cache response!\n",
                 tid);
     } else if (fetchStatus[tid] == ItlbWait) {
-        ++fetchStats.tlbCycles;
+        fetchStats.tlbCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting ITLB walk to "
                 "finish!\n", tid);
     } else if (fetchStatus[tid] == TrapPending) {
-        ++fetchStats.pendingTrapStallCycles;
+        fetchStats.pendingTrapStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for a pending trap!\n",
                 tid);
     } else if (fetchStatus[tid] == QuiescePending) {
-        ++fetchStats.pendingQuiesceStallCycles;
+        fetchStats.pendingQuiesceStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for a pending quiesce "
                 "instruction!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitRetry) {
-        ++fetchStats.icacheWaitRetryStallCycles;
+        fetchStats.icacheWaitRetryStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for an I-cache retry!\n",
                 tid);
     } else if (fetchStatus[tid] == NoGoodAddr) {
@@ -259,6 +259,16 @@ class Fetch
     /** Tells fetch to wake up from a quiesce instruction. */
     void wakeFromQuiesce();
 
+    /**
+     * Returns if fetch cannot make progress until an event, e.g., an
+     * I-cache response, wakes the CPU up. Only a single thread is
+     * considered.
+     */
+    bool canSkipCycles();
+
+    /** Accounts the statistics of cycles skipped while stalled. */
+    void skipCycles(Cycles cycles);
+
     /** For priority-based fetch policies, need to keep update priorityList */
     void deactivateThread(ThreadID tid);
   private:
@@ -384,8 +394,8 @@ class Fetch
     /** Pipeline the next I-cache access to the current one. */
     void pipelineIcacheAccesses(ThreadID tid);
 
-    /** Profile the reasons of fetch stall. */
-    void profileStall(ThreadID tid);
+    /** Profile the reasons of fetch stall over a number of cycles. */
+    void profileStall(ThreadID tid, Cycles cycles=Cycles(1));
 
   private:
     /** Pointer to the O3CPU. */
@@ -415,6 +415,41 @@ IEW::takeOverFrom()
     }
 }
 
+bool
+IEW::canSkipCycles()
+{
+    ThreadID tid = activeThreads->front();
+
+    // A running execute stage broadcasts its free entries every cycle
+    if (exeStatus != Idle || updateLSQNextCycle || !insts[tid].empty())
+        return false;
+
+    if (!instQueue.canSkipCycles() || !ldstQueue.canSkipCycles())
+        return false;
+
+    switch (dispatchStatus[tid]) {
+      case Blocked:
+        return checkStall(tid);
+      case Running:
+      case Idle:
+        return skidBuffer[tid].empty() && !checkStall(tid);
+      default:
+        return false;
+    }
+}
+
+void
+IEW::skipCycles(Cycles cycles)
+{
+    ThreadID tid = activeThreads->front();
+
+    if (dispatchStatus[tid] == Blocked)
+        iewStats.blockCycles += cycles;
+
+    instQueue.skipCycles(cycles);
+    instQueue.iqIOStats.intInstQueueReads += cycles;
+}
+
 void
 IEW::squash(ThreadID tid)
 {
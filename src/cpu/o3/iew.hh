@@ -165,6 +165,15 @@ class IEW
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
+    /** Returns if IEW, including the IQ and the LSQ, cannot make progress
+     * until an event, e.g., a D-cache response, wakes the CPU up. Only a
+     * single thread is considered.
+     */
+    bool canSkipCycles();
+
+    /** Accounts the statistics of cycles skipped while stalled. */
+    void skipCycles(Cycles cycles);
+
     /** Squashes instructions in IEW for a specific thread. */
     void squash(ThreadID tid);
 
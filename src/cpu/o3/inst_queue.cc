@@ -41,6 +41,8 @@
 
 #include "cpu/o3/inst_queue.hh"
 
+#include <array>
+#include <bitset>
 #include <limits>
 #include <vector>
 
@@ -411,14 +413,8 @@ InstructionQueue::resetState()
         squashedSeqNum[tid] = 0;
     }
 
-    for (int i = 0; i < Num_OpClasses; ++i) {
-        while (!readyInsts[i].empty())
-            readyInsts[i].pop();
-        queueOnList[i] = false;
-        readyIt[i] = listOrder.end();
-    }
+    readyInsts.clear();
     nonSpecInsts.clear();
-    listOrder.clear();
     deferredMemInsts.clear();
     blockedMemInsts.clear();
     retryMemInsts.clear();
@@ -542,17 +538,7 @@ InstructionQueue::isFull(ThreadID tid)
 bool
 InstructionQueue::hasReadyInsts()
 {
-    if (!listOrder.empty()) {
-        return true;
-    }
-
-    for (int i = 0; i < Num_OpClasses; ++i) {
-        if (!readyInsts[i].empty()) {
-            return true;
-        }
-    }
-
-    return false;
+    return !readyInsts.empty();
 }
 
 void
@@ -670,57 +656,6 @@ InstructionQueue::getInstToExecute()
     return inst;
 }
 
-void
-InstructionQueue::addToOrderList(OpClass op_class)
-{
-    assert(!readyInsts[op_class].empty());
-
-    ListOrderEntry queue_entry;
-
-    queue_entry.queueType = op_class;
-
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    ListOrderIt list_it = listOrder.begin();
-    ListOrderIt list_end_it = listOrder.end();
-
-    while (list_it != list_end_it) {
-        if ((*list_it).oldestInst > queue_entry.oldestInst) {
-            break;
-        }
-
-        list_it++;
-    }
-
-    readyIt[op_class] = listOrder.insert(list_it, queue_entry);
-    queueOnList[op_class] = true;
-}
-
-void
-InstructionQueue::moveToYoungerInst(ListOrderIt list_order_it)
-{
-    // Get iterator of next item on the list
-    // Delete the original iterator
-    // Determine if the next item is either the end of the list or younger
-    // than the new instruction.  If so, then add in a new iterator right here.
-    // If not, then move along.
-    ListOrderEntry queue_entry;
-    OpClass op_class = (*list_order_it).queueType;
-    ListOrderIt next_it = list_order_it;
-
-    ++next_it;
-
-    queue_entry.queueType = op_class;
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    while (next_it != listOrder.end() &&
-           (*next_it).oldestInst < queue_entry.oldestInst) {
-        ++next_it;
-    }
-
-    readyIt[op_class] = listOrder.insert(next_it, queue_entry);
-}
-
 void
 InstructionQueue::processFUCompletion(const DynInstPtr &inst, int fu_idx)
 {
@@ -762,24 +697,25 @@ InstructionQueue::scheduleReadyInsts()
         addReadyMemInst(mem_inst);
     }
 
-    // Have iterator to head of the list
-    // While I haven't exceeded bandwidth or reached the end of the list,
-    // Try to get a FU that can do what this op needs.
-    // If successful, change the oldestInst to the new top of the list, put
-    // the queue in the proper place in the list.
-    // Increment the iterator.
-    // This will avoid trying to schedule a certain op class if there are no
-    // FUs that handle it.
+    // Walk the ready instructions oldest first until the bandwidth is
+    // exhausted, trying to get a FU that can do what each op needs.
+    // Once no FU is free for an op class, skip the younger instructions
+    // of that class for the rest of the cycle.
     int total_issued = 0;
-    ListOrderIt order_it = listOrder.begin();
-    ListOrderIt order_end_it = listOrder.end();
+    std::bitset<Num_OpClasses> fu_busy;
+    InstSeqNum next_seq_num = 0;
 
-    while (total_issued < totalWidth && order_it != order_end_it) {
-        OpClass op_class = (*order_it).queueType;
+    while (total_issued < totalWidth) {
+        const DynInstPtr *ready_inst = readyInsts.findFrom(next_seq_num);
+        if (!ready_inst)
+            break;
 
-        assert(!readyInsts[op_class].empty());
+        DynInstPtr issuing_inst = *ready_inst;
+        OpClass op_class = issuing_inst->opClass();
+        next_seq_num = issuing_inst->seqNum + 1;
 
-        DynInstPtr issuing_inst = readyInsts[op_class].top();
+        if (fu_busy[op_class])
+            continue;
 
         if (issuing_inst->isFloating()) {
             iqIOStats.fpInstQueueReads++;
@@ -789,19 +725,8 @@ InstructionQueue::scheduleReadyInsts()
             iqIOStats.intInstQueueReads++;
         }
 
-        assert(issuing_inst->seqNum == (*order_it).oldestInst);
-
         if (issuing_inst->isSquashed()) {
-            readyInsts[op_class].pop();
-
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
-
-            listOrder.erase(order_it++);
+            readyInsts.erase(issuing_inst->seqNum);
 
             ++iqStats.squashedInstsIssued;
 
@@ -862,14 +787,7 @@ InstructionQueue::scheduleReadyInsts()
                     tid, issuing_inst->pcState(),
                     issuing_inst->seqNum);
 
-            readyInsts[op_class].pop();
-
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
+            readyInsts.erase(issuing_inst->seqNum);
 
             issuing_inst->setIssued();
             ++total_issued;
@@ -891,12 +809,11 @@ InstructionQueue::scheduleReadyInsts()
                 memDepUnit[tid].issue(issuing_inst);
             }
 
-            listOrder.erase(order_it++);
             iqStats.statIssuedInstType[tid][op_class]++;
         } else {
             iqStats.statFuBusy[op_class]++;
             iqStats.fuBusy[tid]++;
-            ++order_it;
+            fu_busy[op_class] = true;
         }
     }
 
@@ -906,8 +823,10 @@ InstructionQueue::scheduleReadyInsts()
     // If we issued any instructions, tell the CPU we had activity.
     // @todo If the way deferred memory instructions are handeled due to
     // translation changes then the deferredMemInsts condition should be
-    // removed from the code below.
-    if (total_issued || !retryMemInsts.empty() || !deferredMemInsts.empty()) {
+    // removed from the code below. When skipping stalls, the completion
+    // of their delayed translation wakes the CPU up instead.
+    if (total_issued || !retryMemInsts.empty() ||
+        (!cpu->skipStalls && !deferredMemInsts.empty())) {
         cpu->activityThisCycle();
     } else {
         DPRINTF(IQ, "Not able to schedule any instructions.\n");
@@ -1064,17 +983,7 @@ InstructionQueue::addReadyMemInst(const DynInstPtr &ready_inst)
 {
     OpClass op_class = ready_inst->opClass();
 
-    readyInsts[op_class].push(ready_inst);
-
-    // Will need to reorder the list if either a queue is not on the list,
-    // or it has an older instruction than last time.
-    if (!queueOnList[op_class]) {
-        addToOrderList(op_class);
-    } else if (readyInsts[op_class].top()->seqNum  <
-               (*readyIt[op_class]).oldestInst) {
-        listOrder.erase(readyIt[op_class]);
-        addToOrderList(op_class);
-    }
+    readyInsts.insert(ready_inst);
 
     DPRINTF(IQ, "Instruction is ready to issue, putting it onto "
             "the ready list, PC %s opclass:%i [sn:%llu].\n",
@@ -1127,6 +1036,26 @@ InstructionQueue::cacheUnblocked()
     cpu->wakeCPU();
 }
 
+bool
+InstructionQueue::canSkipCycles() const
+{
+    if (!readyInsts.empty() || !instsToExecute.empty() ||
+            !retryMemInsts.empty())
+        return false;
+
+    for (const auto &inst : deferredMemInsts) {
+        if (inst->translationCompleted() || inst->isSquashed())
+            return false;
+    }
+    return true;
+}
+
+void
+InstructionQueue::skipCycles(Cycles cycles)
+{
+    iqStats.numIssuedDist.sample(0, cycles);
+}
+
 DynInstPtr
 InstructionQueue::getDeferredMemInstToExecute()
 {
@@ -1319,13 +1248,6 @@ InstructionQueue::doSquash(ThreadID tid)
     }
 }
 
-bool
-InstructionQueue::PqCompare::operator()(
-        const DynInstPtr &lhs, const DynInstPtr &rhs) const
-{
-    return lhs->seqNum > rhs->seqNum;
-}
-
 bool
 InstructionQueue::addToDependents(const DynInstPtr &new_inst)
 {
@@ -1433,17 +1355,7 @@ InstructionQueue::addIfReady(const DynInstPtr &inst)
                 "the ready list, PC %s opclass:%i [sn:%llu].\n",
                 inst->pcState(), op_class, inst->seqNum);
 
-        readyInsts[op_class].push(inst);
-
-        // Will need to reorder the list if either a queue is not on the list,
-        // or it has an older instruction than last time.
-        if (!queueOnList[op_class]) {
-            addToOrderList(op_class);
-        } else if (readyInsts[op_class].top()->seqNum  <
-                   (*readyIt[op_class]).oldestInst) {
-            listOrder.erase(readyIt[op_class]);
-            addToOrderList(op_class);
-        }
+        readyInsts.insert(inst);
     }
 }
 
@@ -1456,8 +1368,13 @@ InstructionQueue::countInsts()
 void
 InstructionQueue::dumpLists()
 {
+    std::array<int, Num_OpClasses> ready_count{};
+    for (const DynInstPtr *inst = readyInsts.findFrom(0); inst;
+         inst = readyInsts.findFrom((*inst)->seqNum + 1)) {
+        ready_count[(*inst)->opClass()]++;
+    }
     for (int i = 0; i < Num_OpClasses; ++i) {
-        cprintf("Ready list %i size: %i\n", i, readyInsts[i].size());
+        cprintf("Ready list %i size: %i\n", i, ready_count[i]);
 
         cprintf("\n");
     }
@@ -1477,17 +1394,14 @@ InstructionQueue::dumpLists()
 
     cprintf("\n");
 
-    ListOrderIt list_order_it = listOrder.begin();
-    ListOrderIt list_order_end_it = listOrder.end();
     int i = 1;
 
-    cprintf("List order: ");
-
-    while (list_order_it != list_order_end_it) {
-        cprintf("%i OpClass:%i [sn:%llu] ", i, (*list_order_it).queueType,
-                (*list_order_it).oldestInst);
+    cprintf("Ready order: ");
 
-        ++list_order_it;
+    for (const DynInstPtr *inst = readyInsts.findFrom(0); inst;
+         inst = readyInsts.findFrom((*inst)->seqNum + 1)) {
+        cprintf("%i OpClass:%i [sn:%llu] ", i, (*inst)->opClass(),
+                (*inst)->seqNum);
         ++i;
     }
 
@@ -44,7 +44,6 @@
 
 #include <list>
 #include <map>
-#include <queue>
 #include <vector>
 
 #include "base/statistics.hh"
@@ -55,6 +54,7 @@
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/limits.hh"
 #include "cpu/o3/mem_dep_unit.hh"
+#include "cpu/o3/ready_list.hh"
 #include "cpu/o3/store_set.hh"
 #include "cpu/op_class.hh"
 #include "cpu/timebuf.hh"
@@ -79,8 +79,8 @@ class CPU;
 class IEW;
 
 /**
- * A standard instruction queue class.  It holds ready instructions, in
- * order, in seperate priority queues to facilitate the scheduling of
+ * A standard instruction queue class.  It holds ready instructions in age
+ * order, tracked with a bitmap, to facilitate the scheduling of
  * instructions.  The IQ uses a separate linked list to track dependencies.
  * Similar to the rename map and the free list, it expects that
  * floating point registers have their indices start after the integer
@@ -159,6 +159,14 @@ class InstructionQueue
     /** Takes over execution from another CPU's thread. */
     void takeOverFrom();
 
+    /** Returns if the IQ has nothing to issue or execute until a memory
+     * instruction is unblocked, translated or completes.
+     */
+    bool canSkipCycles() const;
+
+    /** Accounts the statistics of cycles skipped while stalled. */
+    void skipCycles(Cycles cycles);
+
     /** Number of entries needed for given amount of threads. */
     int entryAmount(ThreadID num_threads);
 
@@ -335,25 +343,11 @@ class InstructionQueue
      */
     std::list<DynInstPtr> retryMemInsts;
 
-    /**
-     * Struct for comparing entries to be added to the priority queue.
-     * This gives reverse ordering to the instructions in terms of
-     * sequence numbers: the instructions with smaller sequence
-     * numbers (and hence are older) will be at the top of the
-     * priority queue.
+    /** Ready instructions of all op classes, in age order. The scheduler
+     *  walks them oldest first, skipping the op classes whose FUs are all
+     *  busy.
      */
-    struct PqCompare
-    {
-        bool operator()(const DynInstPtr &lhs, const DynInstPtr &rhs) const;
-    };
-
-    typedef std::priority_queue<
-        DynInstPtr, std::vector<DynInstPtr>, PqCompare> ReadyInstQueue;
-
-    /** List of ready instructions, per op class.  They are separated by op
-     *  class to allow for easy mapping to FUs.
-     */
-    ReadyInstQueue readyInsts[Num_OpClasses];
+    ReadyList<DynInstPtr> readyInsts;
 
     /** List of non-speculative instructions that will be scheduled
      *  once the IQ gets a signal from commit.  While it's redundant to
@@ -366,41 +360,6 @@ class InstructionQueue
 
     typedef std::map<InstSeqNum, DynInstPtr>::iterator NonSpecMapIt;
 
-    /** Entry for the list age ordering by op class. */
-    struct ListOrderEntry
-    {
-        OpClass queueType;
-        InstSeqNum oldestInst;
-    };
-
-    /** List that contains the age order of the oldest instruction of each
-     *  ready queue.  Used to select the oldest instruction available
-     *  among op classes.
-     *  @todo: Might be better to just move these entries around instead
-     *  of creating new ones every time the position changes due to an
-     *  instruction issuing.  Not sure std::list supports this.
-     */
-    std::list<ListOrderEntry> listOrder;
-
-    typedef typename std::list<ListOrderEntry>::iterator ListOrderIt;
-
-    /** Tracks if each ready queue is on the age order list. */
-    bool queueOnList[Num_OpClasses];
-
-    /** Iterators of each ready queue.  Points to their spot in the age order
-     *  list.
-     */
-    ListOrderIt readyIt[Num_OpClasses];
-
-    /** Add an op class to the age order list. */
-    void addToOrderList(OpClass op_class);
-
-    /**
-     * Called when the oldest instruction has been removed from a ready queue;
-     * this places that ready queue into the proper spot in the age order list.
-     */
-    void moveToYoungerInst(ListOrderIt age_order_it);
-
     DependencyGraph<DynInstPtr> dependGraph;
 
     //////////////////////////////////////
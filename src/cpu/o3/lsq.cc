@@ -745,6 +745,20 @@ LSQ::willWB()
     return false;
 }
 
+bool
+LSQ::canSkipCycles()
+{
+    if (usedLoadPorts || usedStorePorts)
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (!thread[tid].canSkipCycles())
+            return false;
+    }
+
+    return true;
+}
+
 bool
 LSQ::willWB(ThreadID tid)
 {
@@ -886,6 +900,11 @@ LSQ::SingleDataRequest::finish(const Fault &fault, const RequestPtr &req,
 
         LSQRequest::_inst->fault = fault;
         LSQRequest::_inst->translationCompleted(true);
+
+        // A delayed translation completes in an event of its own, so the
+        // CPU may have stopped ticking in the meantime.
+        if (isDelayed())
+            _inst->cpu->wakeCPU();
     }
 }
 
@@ -932,6 +951,10 @@ LSQ::SplitDataRequest::finish(const Fault &fault, const RequestPtr &req,
                 _inst->fault = _fault[0];
                 setState(State::Fault);
             }
+
+            // See SingleDataRequest::finish()
+            if (isDelayed())
+                _inst->cpu->wakeCPU();
         }
 
     }
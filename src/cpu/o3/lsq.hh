@@ -956,6 +956,11 @@ class LSQ
      */
     bool willWB(ThreadID tid);
 
+    /** Returns if no LSQ unit can make progress until an event, e.g., a
+     * cache response or retry, wakes the CPU up.
+     */
+    bool canSkipCycles();
+
     /** Debugging function to print out all instructions. */
     void dumpInsts() const;
     /** Debugging function to print out instructions from a specific thread. */
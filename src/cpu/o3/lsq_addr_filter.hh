@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_LSQ_ADDR_FILTER_HH__
+#define __CPU_O3_LSQ_ADDR_FILTER_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Counting filter of the addresses accessed by the entries of a load or
+ * store queue. Addresses are split in granules of 2^shift bytes, the same
+ * granularity used by the memory order violation check, and each granule
+ * is hashed to a bucket counting the entries accessing it. Accesses
+ * spanning many granules are only counted as wide accesses, which may
+ * overlap with anything.
+ *
+ * A search of the queue for an access overlapping an address range can
+ * be skipped when none of the buckets of the range is used. The filter
+ * has false positives, from bucket aliasing and entries which are not
+ * relevant to the search, but no false negatives, so that skipping a
+ * search never changes the outcome of the search.
+ */
+class LSQAddrFilter
+{
+  private:
+    /** Accesses spanning more granules than this are wide. */
+    static constexpr Addr MaxGranules = 16;
+
+    std::vector<uint32_t> counts;
+    size_t mask;
+    unsigned bits;
+    unsigned shift;
+
+    /** Number of wide accesses. */
+    uint32_t wide;
+
+    /** Folds the upper bits of a granule, so that arrays a large power
+     * of 2 apart do not alias. */
+    size_t
+    bucket(Addr granule) const
+    {
+        return (granule ^ (granule >> bits) ^ (granule >> (2 * bits))) &
+            mask;
+    }
+
+    bool
+    isWide(Addr addr, unsigned size) const
+    {
+        assert(size != 0);
+        return ((addr + size - 1) >> shift) - (addr >> shift) >= MaxGranules;
+    }
+
+    /** Calls f on the bucket of each granule of a range. */
+    template <typename F>
+    void
+    forEachBucket(Addr addr, unsigned size, F f) const
+    {
+        Addr last = (addr + size - 1) >> shift;
+        for (Addr granule = addr >> shift; granule <= last; granule++)
+            f(bucket(granule));
+    }
+
+  public:
+    /**
+     * @param num_buckets Number of buckets, rounded up to a power of 2.
+     * @param granule_shift Log2 of the granule size in bytes.
+     */
+    LSQAddrFilter(size_t num_buckets=1, unsigned granule_shift=0)
+        : counts(1ULL << ceilLog2(std::max<size_t>(num_buckets, 1)), 0),
+          mask(counts.size() - 1), bits(ceilLog2(counts.size())),
+          shift(granule_shift), wide(0)
+    {}
+
+    /** Adds an access of an entry to the filter. */
+    void
+    insert(Addr addr, unsigned size)
+    {
+        if (isWide(addr, size))
+            wide++;
+        else
+            forEachBucket(addr, size, [this](size_t b) { counts[b]++; });
+    }
+
+    /** Removes an access previously inserted in the filter. */
+    void
+    remove(Addr addr, unsigned size)
+    {
+        if (isWide(addr, size)) {
+            assert(wide != 0);
+            wide--;
+        } else {
+            forEachBucket(addr, size, [this](size_t b) {
+                assert(counts[b] != 0);
+                counts[b]--;
+            });
+        }
+    }
+
+    /**
+     * Returns if an entry of the queue may access any of the granules of
+     * an address range.
+     *
+     * @param own Number of accesses to exactly this range to disregard,
+     *            e.g., the one of the instruction doing the search.
+     */
+    bool
+    mayOverlap(Addr addr, unsigned size, unsigned own=0) const
+    {
+        if (wide != 0 || isWide(addr, size))
+            return true;
+
+        // A granule aliasing with another one of the range counts an own
+        // access twice, which can only cause a false positive.
+        bool found = false;
+        forEachBucket(addr, size, [&](size_t b) {
+            assert(counts[b] >= own);
+            found = found || counts[b] > own;
+        });
+        return found;
+    }
+
+    /** Removes all the accesses from the filter. */
+    void
+    clear()
+    {
+        std::fill(counts.begin(), counts.end(), 0);
+        wide = 0;
+    }
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_LSQ_ADDR_FILTER_HH__
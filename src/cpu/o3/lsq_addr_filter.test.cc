@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+#include <utility>
+
+#include "cpu/o3/lsq_addr_filter.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+namespace
+{
+
+typedef std::pair<Addr, unsigned> Access;
+
+/** Granule shift of the default LSQDepCheckShift. */
+constexpr unsigned Shift = 4;
+
+/** The linear search of the queue the filter allows skipping. */
+bool
+scanOverlap(const std::deque<Access> &queue, Addr addr, unsigned size)
+{
+    Addr first = addr >> Shift;
+    Addr last = (addr + size - 1) >> Shift;
+    for (const auto &[a, s] : queue) {
+        if (last >= (a >> Shift) && first <= ((a + s - 1) >> Shift))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Accesses of a store-heavy streaming kernel, a[i] = b[i] * s + c[i],
+ * with 8 byte elements and arrays 1 MiB apart.
+ */
+Access
+kernelAccess(unsigned i, bool store)
+{
+    Addr elem = (i / 2) * 8;
+    if (store)
+        return {0x100000 + elem, 8};
+    return {(i % 2 ? 0x200000 : 0x300000) + elem, 8};
+}
+
+} // anonymous namespace
+
+TEST(LSQAddrFilterTest, InsertRemove)
+{
+    LSQAddrFilter filter(64, Shift);
+
+    EXPECT_FALSE(filter.mayOverlap(0x1000, 8));
+    filter.insert(0x1000, 8);
+    EXPECT_TRUE(filter.mayOverlap(0x1000, 8));
+    // Same granule, different bytes
+    EXPECT_TRUE(filter.mayOverlap(0x100c, 4));
+    // Next granule
+    EXPECT_FALSE(filter.mayOverlap(0x1010, 8));
+    // Range ending in the granule
+    EXPECT_TRUE(filter.mayOverlap(0xff8, 9));
+    EXPECT_FALSE(filter.mayOverlap(0xff8, 8));
+
+    filter.insert(0x1000, 8);
+    filter.remove(0x1000, 8);
+    EXPECT_TRUE(filter.mayOverlap(0x1000, 8));
+    filter.remove(0x1000, 8);
+    EXPECT_FALSE(filter.mayOverlap(0x1000, 8));
+}
+
+/** The access of the searching instruction itself can be disregarded. */
+TEST(LSQAddrFilterTest, Own)
+{
+    LSQAddrFilter filter(64, Shift);
+
+    filter.insert(0x1008, 16);
+    EXPECT_FALSE(filter.mayOverlap(0x1008, 16, 1));
+    filter.insert(0x1010, 4);
+    EXPECT_TRUE(filter.mayOverlap(0x1008, 16, 1));
+}
+
+/** Ranges spanning many granules may overlap with anything. */
+TEST(LSQAddrFilterTest, WideRange)
+{
+    LSQAddrFilter filter(64, Shift);
+
+    filter.insert(0x1000, 512);
+    EXPECT_TRUE(filter.mayOverlap(0x80000, 8));
+    filter.remove(0x1000, 512);
+    EXPECT_FALSE(filter.mayOverlap(0x80000, 8));
+    EXPECT_TRUE(filter.mayOverlap(0x1000, 512));
+}
+
+/** Arrays a large power of 2 apart do not alias. */
+TEST(LSQAddrFilterTest, PowerOf2Strides)
+{
+    LSQAddrFilter filter(512, Shift);
+
+    filter.insert(0x100000, 8);
+    EXPECT_FALSE(filter.mayOverlap(0x200000, 8));
+    EXPECT_FALSE(filter.mayOverlap(0x300000, 8));
+}
+
+/** The filter never misses an overlap found by the linear search. */
+TEST(LSQAddrFilterTest, NoFalseNegatives)
+{
+    std::mt19937_64 rng(1);
+    LSQAddrFilter filter(4 * 128, Shift);
+    std::deque<Access> queue;
+
+    for (int i = 0; i < 100000; i++) {
+        Access access(rng() % 0x4000, 1 << (rng() % 7));
+        if (queue.size() == 128 || (!queue.empty() && rng() % 3 == 0)) {
+            filter.remove(queue.front().first, queue.front().second);
+            queue.pop_front();
+        }
+        if (scanOverlap(queue, access.first, access.second)) {
+            ASSERT_TRUE(filter.mayOverlap(access.first, access.second));
+        }
+        filter.insert(access.first, access.second);
+        queue.push_back(access);
+    }
+}
+
+/**
+ * For a streaming kernel over full 128 entry queues, the searches the
+ * filter lets through find the same overlaps as searching every time.
+ */
+TEST(LSQAddrFilterTest, KernelOverlaps)
+{
+    constexpr unsigned QueueSize = 128;
+    LSQAddrFilter loads(4 * QueueSize, Shift);
+    LSQAddrFilter stores(4 * QueueSize, Shift);
+    std::deque<Access> lq, sq;
+    unsigned searched = 0;
+
+    for (unsigned i = 0; i < 100000; i++) {
+        bool is_store = i % 3 == 2;
+        Access access = kernelAccess(i, is_store);
+        auto &queue = is_store ? sq : lq;
+        auto &filter = is_store ? stores : loads;
+        // Stores search the LQ for violations, loads the SQ for
+        // forwarding.
+        auto &other = is_store ? lq : sq;
+        auto &other_filter = is_store ? loads : stores;
+
+        bool overlap = scanOverlap(other, access.first, access.second);
+        if (other_filter.mayOverlap(access.first, access.second))
+            searched++;
+        else
+            ASSERT_FALSE(overlap);
+
+        if (queue.size() == QueueSize) {
+            filter.remove(queue.front().first, queue.front().second);
+            queue.pop_front();
+        }
+        filter.insert(access.first, access.second);
+        queue.push_back(access);
+    }
+
+    // The arrays do not alias, so almost every search is filtered out.
+    EXPECT_LT(searched, 1000u);
+}
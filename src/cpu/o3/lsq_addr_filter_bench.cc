@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Searches per second of full 128 entry load and store queues for a
+ * streaming kernel, with and without LSQAddrFilter in front of the
+ * linear search. The rates depend on the host, so this is a standalone
+ * program rather than a unit test.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <utility>
+
+#include "cpu/o3/lsq_addr_filter.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+namespace
+{
+
+typedef std::pair<Addr, unsigned> Access;
+
+/** Granule shift of the default LSQDepCheckShift. */
+constexpr unsigned Shift = 4;
+constexpr unsigned QueueSize = 128;
+constexpr unsigned Searches = 1 << 20;
+
+bool
+scanOverlap(const std::deque<Access> &queue, Addr addr, unsigned size)
+{
+    Addr first = addr >> Shift;
+    Addr last = (addr + size - 1) >> Shift;
+    for (const auto &[a, s] : queue) {
+        if (last >= (a >> Shift) && first <= ((a + s - 1) >> Shift))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Accesses of a store-heavy streaming kernel, a[i] = b[i] * s + c[i],
+ * with 8 byte elements and arrays 1 MiB apart.
+ */
+Access
+kernelAccess(unsigned i, bool store)
+{
+    Addr elem = (i / 2) * 8;
+    if (store)
+        return {0x100000 + elem, 8};
+    return {(i % 2 ? 0x200000 : 0x300000) + elem, 8};
+}
+
+double
+searchRate(bool filtered, uint64_t &overlaps)
+{
+    LSQAddrFilter loads(4 * QueueSize, Shift);
+    LSQAddrFilter stores(4 * QueueSize, Shift);
+    std::deque<Access> lq, sq;
+    overlaps = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < Searches; i++) {
+        bool is_store = i % 3 == 2;
+        Access access = kernelAccess(i, is_store);
+        auto &queue = is_store ? sq : lq;
+        auto &filter = is_store ? stores : loads;
+        // Stores search the LQ for violations, loads the SQ for
+        // forwarding.
+        auto &other = is_store ? lq : sq;
+        auto &other_filter = is_store ? loads : stores;
+
+        if (!filtered ||
+                other_filter.mayOverlap(access.first, access.second)) {
+            overlaps += scanOverlap(other, access.first, access.second);
+        }
+
+        if (queue.size() == QueueSize) {
+            filter.remove(queue.front().first, queue.front().second);
+            queue.pop_front();
+        }
+        filter.insert(access.first, access.second);
+        queue.push_back(access);
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return Searches / elapsed.count();
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    uint64_t linear_overlaps, filtered_overlaps;
+    double linear = searchRate(false, linear_overlaps);
+    double filtered = searchRate(true, filtered_overlaps);
+
+    if (linear_overlaps != filtered_overlaps) {
+        std::cerr << "Search results differ\n";
+        return 1;
+    }
+
+    std::cout << "Linear search: " << linear / 1e6 << " M searches/s\n"
+              << "Address filter: " << filtered / 1e6 << " M searches/s ("
+              << filtered / linear << "x)\n";
+    return 0;
+}
@@ -229,6 +229,11 @@ LSQUnit::init(CPU *cpu_ptr, IEW *iew_ptr, const O3CPUParams &params,
     checkLoads = params.LSQCheckLoads;
     needsTSO = params.needsTSO;
 
+    loadFilter = LSQAddrFilter(
+            FilterBucketsPerEntry * loadQueue.capacity(), depCheckShift);
+    storeFilter = LSQAddrFilter(
+            FilterBucketsPerEntry * storeQueue.capacity(), depCheckShift);
+
     resetState();
 }
 
@@ -247,6 +252,9 @@ LSQUnit::resetState()
     retryPkt = NULL;
     memDepViolator = NULL;
 
+    loadFilter.clear();
+    storeFilter.clear();
+
     stalled = false;
 
     cacheBlockMask = ~(cpu->cacheLineSize() - 1);
@@ -520,6 +528,49 @@ LSQUnit::checkSnoop(PacketPtr pkt)
     return;
 }
 
+void
+LSQUnit::filterInsert(LSQAddrFilter &filter, LSQEntry &entry)
+{
+    filterRemove(filter, entry);
+
+    const DynInstPtr &inst = entry.instruction();
+    if (inst->effSize != 0) {
+        filter.insert(inst->effAddr, inst->effSize);
+        entry.filterAddr() = inst->effAddr;
+        entry.filterSize() = inst->effSize;
+    }
+}
+
+void
+LSQUnit::filterRemove(LSQAddrFilter &filter, LSQEntry &entry)
+{
+    if (entry.filterSize() != 0) {
+        filter.remove(entry.filterAddr(), entry.filterSize());
+        entry.filterSize() = 0;
+    }
+}
+
+bool
+LSQUnit::loadsMayOverlap(const DynInstPtr &inst)
+{
+    if (inst->effSize == 0)
+        return true;
+
+    // A load is in the filter itself, with the address it executed with
+    unsigned own = 0;
+    if (inst->isLoad()) {
+        LQEntry &entry = *inst->lqIt;
+        if (entry.filterSize() != 0) {
+            if (entry.filterAddr() != inst->effAddr ||
+                    entry.filterSize() != inst->effSize)
+                return true;
+            own = 1;
+        }
+    }
+
+    return loadFilter.mayOverlap(inst->effAddr, inst->effSize, own);
+}
+
 Fault
 LSQUnit::checkViolations(typename LoadQueue::iterator& loadIt,
         const DynInstPtr& inst)
@@ -532,6 +583,9 @@ LSQUnit::checkViolations(typename LoadQueue::iterator& loadIt,
      * all instructions that will execute before the store writes back. Thus,
      * like the implementation that came before it, we're overly conservative.
      */
+    if (!loadsMayOverlap(inst))
+        return NoFault;
+
     while (loadIt != loadQueue.end()) {
         DynInstPtr ld_inst = loadIt->instruction();
         if (!ld_inst->effAddrValid() || ld_inst->strictlyOrdered()) {
@@ -736,6 +790,7 @@ LSQUnit::commitLoad()
                     inst->lastWakeDependents - inst->firstIssue));
     }
 
+    filterRemove(loadFilter, loadQueue.front());
     loadQueue.front().clear();
     loadQueue.pop_front();
 
@@ -881,10 +936,11 @@ LSQUnit::writebackStores()
             // Disable recording the result temporarily.  Writing to
             // misc regs normally updates the result, but this is not
             // the desired behavior when handling store conditionals.
+            bool record_result = inst->recordingResult();
             inst->recordResult(false);
             bool success = TheISA::handleLockedWrite(inst.get(),
                     req->request(), cacheBlockMask);
-            inst->recordResult(true);
+            inst->recordResult(record_result);
             req->packetSent();
 
             if (!success) {
@@ -970,6 +1026,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         }
         // Clear the smart pointer to make sure it is decremented.
         loadQueue.back().instruction()->setSquashed();
+        filterRemove(loadFilter, loadQueue.back());
         loadQueue.back().clear();
 
         --loads;
@@ -1043,6 +1100,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         // Must delete request now that it wasn't handed off to
         // memory.  This is quite ugly.  @todo: Figure out the proper
         // place to really handle request deletes.
+        filterRemove(storeFilter, storeQueue.back());
         storeQueue.back().clear();
         --stores;
 
@@ -1168,6 +1226,7 @@ LSQUnit::completeStore(typename StoreQueue::iterator store_idx)
     DynInstPtr store_inst = store_idx->instruction();
     if (store_idx == storeQueue.begin()) {
         do {
+            filterRemove(storeFilter, storeQueue.front());
             storeQueue.front().clear();
             storeQueue.pop_front();
             --stores;
@@ -1258,6 +1317,17 @@ LSQUnit::trySendPacket(bool isLoad, PacketPtr data_pkt)
     return ret;
 }
 
+bool
+LSQUnit::canSkipCycles()
+{
+    if (isStoreBlocked)
+        return lsq->cacheBlocked();
+
+    return storesToWB == 0 || !storeWBIt.dereferenceable() ||
+        !storeWBIt->valid() || !storeWBIt->canWB() ||
+        (needsTSO && storeInFlight);
+}
+
 void
 LSQUnit::recvRetry()
 {
@@ -1310,6 +1380,8 @@ LSQUnit::read(LSQRequest *req, int load_idx)
     load_req.setRequest(req);
     assert(load_inst);
 
+    filterInsert(loadFilter, load_req);
+
     assert(!load_inst->isExecuted());
 
     // Make sure this isn't a strictly ordered load
@@ -1347,9 +1419,10 @@ LSQUnit::read(LSQRequest *req, int load_idx)
         // Disable recording the result temporarily.  Writing to misc
         // regs normally updates the result, but this is not the
         // desired behavior when handling store conditionals.
+        bool record_result = load_inst->recordingResult();
         load_inst->recordResult(false);
         TheISA::handleLockedRead(load_inst.get(), req->mainRequest());
-        load_inst->recordResult(true);
+        load_inst->recordResult(record_result);
     }
 
     if (req->mainRequest()->isLocalAccess()) {
@@ -1400,9 +1473,13 @@ LSQUnit::read(LSQRequest *req, int load_idx)
         }
     }
 
-    // Check the SQ for any previous stores that might lead to forwarding
+    // Check the SQ for any previous stores that might lead to forwarding,
+    // unless no store in the SQ may overlap with the load
     auto store_it = load_inst->sqIt;
     assert (store_it >= storeWBIt);
+    if (load_inst->effSize != 0 &&
+            !storeFilter.mayOverlap(load_inst->effAddr, load_inst->effSize))
+        store_it = storeWBIt;
     // End once we've reached the top of the LSQ
     while (store_it != storeWBIt && !load_inst->isDataPrefetch()) {
         // Move the index to one younger
@@ -1637,6 +1714,7 @@ LSQUnit::write(LSQRequest *req, uint8_t *data, int store_idx)
     storeQueue[store_idx].setRequest(req);
     unsigned size = req->_size;
     storeQueue[store_idx].size() = size;
+    filterInsert(storeFilter, storeQueue[store_idx]);
     bool store_no_data =
         req->mainRequest()->getFlags() & Request::STORE_NO_DATA;
     storeQueue[store_idx].isAllZeros() = store_no_data;
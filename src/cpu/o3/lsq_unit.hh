@@ -59,6 +59,7 @@
 #include "cpu/o3/cpu.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/lsq.hh"
+#include "cpu/o3/lsq_addr_filter.hh"
 #include "cpu/timebuf.hh"
 #include "debug/HtmCpu.hh"
 #include "debug/LSQUnit.hh"
@@ -106,6 +107,10 @@ class LSQUnit
         uint32_t _size = 0;
         /** Valid entry. */
         bool _valid = false;
+        /** The access of the entry in the address filter of its queue, if
+         * its size is not zero. */
+        Addr _filterAddr = 0;
+        uint32_t _filterSize = 0;
 
       public:
         ~LSQEntry()
@@ -126,6 +131,7 @@ class LSQUnit
             req = nullptr;
             _valid = false;
             _size = 0;
+            assert(_filterSize == 0);
         }
 
         void
@@ -145,6 +151,8 @@ class LSQUnit
         bool valid() const { return _valid; }
         uint32_t& size() { return _size; }
         const uint32_t& size() const { return _size; }
+        Addr& filterAddr() { return _filterAddr; }
+        uint32_t& filterSize() { return _filterSize; }
         const DynInstPtr& instruction() const { return inst; }
         /** @} */
     };
@@ -357,6 +365,11 @@ class LSQUnit
                         !isStoreBlocked;
     }
 
+    /** Returns if the LSQ unit cannot write back a store until the cache
+     * unblocks or an outstanding store completes.
+     */
+    bool canSkipCycles();
+
     /** Handles doing the retry. */
     void recvRetry();
 
@@ -377,6 +390,19 @@ class LSQUnit
     /** Handles completing the send of a store to memory. */
     void storePostSend();
 
+    /** Adds the access of the instruction of an entry to an address
+     * filter, replacing the previous access of the entry if any.
+     */
+    void filterInsert(LSQAddrFilter &filter, LSQEntry &entry);
+
+    /** Removes the access of an entry from an address filter, if any. */
+    void filterRemove(LSQAddrFilter &filter, LSQEntry &entry);
+
+    /** Returns if a load in the LQ, other than the instruction itself,
+     * may access the same granules as the instruction.
+     */
+    bool loadsMayOverlap(const DynInstPtr &inst);
+
   public:
     /** Attempts to send a packet to the cache.
      * Check if there are ports available. Return true if
@@ -493,6 +519,15 @@ class LSQUnit
      */
     unsigned depCheckShift;
 
+    /** Number of address filter buckets per queue entry. */
+    static constexpr size_t FilterBucketsPerEntry = 4;
+
+    /** Filters of the addresses accessed by the loads and stores, used to
+     * skip searching the queues for overlapping accesses.
+     */
+    LSQAddrFilter loadFilter;
+    LSQAddrFilter storeFilter;
+
     /** Should loads be checked for dependency issues */
     bool checkLoads;
 
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_READY_LIST_HH__
+#define __CPU_O3_READY_LIST_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "cpu/inst_seq.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Set of ready instructions kept in age (sequence number) order, so the
+ * scheduler can walk them oldest first at a cost proportional to the
+ * number of ready instructions, independent of the IQ size or the number
+ * of op classes.
+ *
+ * Instructions are held in a ring indexed by their sequence number, with
+ * a bitmap marking the occupied slots and a summary bitmap marking the
+ * non-empty bitmap words. The ring has to span the sequence numbers of
+ * all the ready instructions and grows (rarely) when they spread further
+ * apart, e.g., when an old instruction waits while younger ones are
+ * squashed and refetched.
+ */
+template <class DynInstPtr>
+class ReadyList
+{
+  private:
+    static constexpr size_t WordBits = 64;
+    static constexpr size_t NoSlot = (size_t)-1;
+
+    std::vector<DynInstPtr> slots;
+    std::vector<uint64_t> words;
+    std::vector<uint64_t> summary;
+    size_t mask;
+
+    /** Bounds of the sequence numbers in the set, if not empty. */
+    InstSeqNum oldest;
+    InstSeqNum youngest;
+    size_t numInsts;
+
+    size_t slot(InstSeqNum seq_num) const { return seq_num & mask; }
+
+    bool
+    isSet(size_t idx) const
+    {
+        return words[idx / WordBits] & (1ULL << (idx % WordBits));
+    }
+
+    /** First occupied slot at or after idx, without wrapping around. */
+    size_t
+    findSlot(size_t idx) const
+    {
+        size_t w = idx / WordBits;
+        uint64_t word = words[w] & (~0ULL << (idx % WordBits));
+        if (word)
+            return w * WordBits + findLsbSet(word);
+
+        for (size_t next = w + 1; next < words.size();) {
+            size_t s = next / WordBits;
+            uint64_t sum = summary[s] & (~0ULL << (next % WordBits));
+            if (sum) {
+                w = s * WordBits + findLsbSet(sum);
+                return w * WordBits + findLsbSet(words[w]);
+            }
+            next = (s + 1) * WordBits;
+        }
+        return NoSlot;
+    }
+
+    void
+    resize(size_t num_slots)
+    {
+        std::vector<DynInstPtr> insts;
+        insts.reserve(numInsts);
+        for (const DynInstPtr *inst = findFrom(oldest); inst;
+             inst = findFrom((*inst)->seqNum + 1)) {
+            insts.push_back(*inst);
+        }
+
+        slots.assign(num_slots, DynInstPtr());
+        words.assign(num_slots / WordBits, 0);
+        summary.assign(std::max<size_t>(words.size() / WordBits, 1), 0);
+        mask = num_slots - 1;
+
+        for (const auto &inst : insts)
+            place(inst);
+    }
+
+    void
+    place(const DynInstPtr &inst)
+    {
+        size_t idx = slot(inst->seqNum);
+        assert(!isSet(idx));
+        slots[idx] = inst;
+        size_t w = idx / WordBits;
+        words[w] |= 1ULL << (idx % WordBits);
+        summary[w / WordBits] |= 1ULL << (w % WordBits);
+    }
+
+  public:
+    /** @param num_slots Initial span of the ring, a power of 2. */
+    explicit ReadyList(size_t num_slots=4096)
+        : oldest(0), youngest(0), numInsts(0)
+    {
+        assert(num_slots >= WordBits && isPowerOf2(num_slots));
+        resize(num_slots);
+    }
+
+    bool empty() const { return numInsts == 0; }
+    size_t size() const { return numInsts; }
+
+    /** Add an instruction, which must not be in the set already. */
+    void
+    insert(const DynInstPtr &inst)
+    {
+        const InstSeqNum seq_num = inst->seqNum;
+        if (numInsts == 0) {
+            oldest = youngest = seq_num;
+        } else {
+            if (std::max(youngest, seq_num) - std::min(oldest, seq_num) >=
+                    slots.size()) {
+                // The oldest bound may be stale, tighten it first
+                oldest = (*findFrom(oldest))->seqNum;
+                size_t num_slots = slots.size();
+                while (std::max(youngest, seq_num) -
+                       std::min(oldest, seq_num) >= num_slots) {
+                    num_slots *= 2;
+                }
+                if (num_slots != slots.size())
+                    resize(num_slots);
+            }
+            oldest = std::min(oldest, seq_num);
+            youngest = std::max(youngest, seq_num);
+        }
+
+        place(inst);
+        numInsts++;
+    }
+
+    /** Remove the instruction with the given sequence number. */
+    void
+    erase(InstSeqNum seq_num)
+    {
+        size_t idx = slot(seq_num);
+        assert(isSet(idx) && slots[idx]->seqNum == seq_num);
+        slots[idx] = DynInstPtr();
+        size_t w = idx / WordBits;
+        words[w] &= ~(1ULL << (idx % WordBits));
+        if (!words[w])
+            summary[w / WordBits] &= ~(1ULL << (w % WordBits));
+        numInsts--;
+    }
+
+    /**
+     * The oldest instruction with a sequence number of at least seq_num,
+     * or nullptr if there is none.
+     */
+    const DynInstPtr *
+    findFrom(InstSeqNum seq_num) const
+    {
+        if (numInsts == 0)
+            return nullptr;
+        seq_num = std::max(seq_num, oldest);
+        if (seq_num > youngest)
+            return nullptr;
+
+        // All the instructions are within a ring span of the oldest one,
+        // so walking the ring from seq_num finds the instructions at least
+        // as young as seq_num first.
+        const size_t start = slot(seq_num);
+        size_t idx = findSlot(start);
+        size_t distance;
+        if (idx != NoSlot) {
+            distance = idx - start;
+        } else {
+            idx = findSlot(0);
+            if (idx == NoSlot)
+                return nullptr;
+            distance = idx + slots.size() - start;
+        }
+        if (distance > youngest - seq_num)
+            return nullptr;
+        return &slots[idx];
+    }
+
+    void
+    clear()
+    {
+        std::fill(slots.begin(), slots.end(), DynInstPtr());
+        std::fill(words.begin(), words.end(), 0);
+        std::fill(summary.begin(), summary.end(), 0);
+        numInsts = 0;
+    }
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_READY_LIST_HH__
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "cpu/o3/ready_list.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+namespace
+{
+
+struct Inst
+{
+    InstSeqNum seqNum;
+    int opClass;
+    bool squashed;
+};
+
+typedef Inst *InstPtr;
+
+constexpr int NumOpClasses = 4;
+
+/**
+ * A pool of single cycle FUs, each able to execute a set of op classes,
+ * handing out the first free capable unit like FUPool::getUnit().
+ */
+class FUs
+{
+  private:
+    std::vector<unsigned> capabilities;
+    std::vector<bool> busy;
+
+  public:
+    explicit FUs(std::vector<unsigned> caps)
+        : capabilities(caps), busy(caps.size())
+    {}
+
+    void newCycle() { std::fill(busy.begin(), busy.end(), false); }
+
+    bool
+    getUnit(int op_class)
+    {
+        for (size_t i = 0; i < capabilities.size(); i++) {
+            if (!busy[i] && (capabilities[i] & (1 << op_class))) {
+                busy[i] = true;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * The scheduler ReadyList replaced: a priority queue of ready
+ * instructions per op class and a list of the classes ordered by their
+ * oldest instruction, walked as in InstructionQueue::scheduleReadyInsts.
+ */
+class PerClassScheduler
+{
+  private:
+    struct Older
+    {
+        bool
+        operator()(const InstPtr &a, const InstPtr &b) const
+        {
+            return a->seqNum > b->seqNum;
+        }
+    };
+
+    std::priority_queue<InstPtr, std::vector<InstPtr>, Older>
+        ready[NumOpClasses];
+
+    struct OrderEntry
+    {
+        int opClass;
+        InstSeqNum oldestInst;
+    };
+    std::list<OrderEntry> listOrder;
+    std::list<OrderEntry>::iterator readyIt[NumOpClasses];
+    bool onList[NumOpClasses] = {};
+
+    void
+    addToOrderList(int op_class)
+    {
+        OrderEntry entry{op_class, ready[op_class].top()->seqNum};
+        auto it = listOrder.begin();
+        while (it != listOrder.end() && it->oldestInst <= entry.oldestInst)
+            it++;
+        readyIt[op_class] = listOrder.insert(it, entry);
+        onList[op_class] = true;
+    }
+
+    void
+    moveToYoungerInst(std::list<OrderEntry>::iterator it)
+    {
+        int op_class = it->opClass;
+        OrderEntry entry{op_class, ready[op_class].top()->seqNum};
+        auto next = std::next(it);
+        while (next != listOrder.end() && next->oldestInst < entry.oldestInst)
+            next++;
+        readyIt[op_class] = listOrder.insert(next, entry);
+    }
+
+  public:
+    void
+    insert(const InstPtr &inst)
+    {
+        int op_class = inst->opClass;
+        ready[op_class].push(inst);
+        if (!onList[op_class]) {
+            addToOrderList(op_class);
+        } else if (ready[op_class].top()->seqNum <
+                   readyIt[op_class]->oldestInst) {
+            listOrder.erase(readyIt[op_class]);
+            addToOrderList(op_class);
+        }
+    }
+
+    std::vector<InstSeqNum>
+    schedule(FUs &fus, size_t width)
+    {
+        std::vector<InstSeqNum> issued;
+        auto it = listOrder.begin();
+        while (issued.size() < width && it != listOrder.end()) {
+            int op_class = it->opClass;
+            InstPtr inst = ready[op_class].top();
+            if (!inst->squashed && !fus.getUnit(op_class)) {
+                ++it;
+                continue;
+            }
+            if (!inst->squashed)
+                issued.push_back(inst->seqNum);
+            ready[op_class].pop();
+            if (!ready[op_class].empty()) {
+                moveToYoungerInst(it);
+            } else {
+                onList[op_class] = false;
+            }
+            listOrder.erase(it++);
+        }
+        return issued;
+    }
+};
+
+/** The walk of InstructionQueue::scheduleReadyInsts over a ReadyList. */
+std::vector<InstSeqNum>
+scheduleReadyList(ReadyList<InstPtr> &ready, FUs &fus, size_t width)
+{
+    std::vector<InstSeqNum> issued;
+    bool fu_busy[NumOpClasses] = {};
+    InstSeqNum next_seq_num = 0;
+    while (issued.size() < width) {
+        const InstPtr *ready_inst = ready.findFrom(next_seq_num);
+        if (!ready_inst)
+            break;
+        InstPtr inst = *ready_inst;
+        next_seq_num = inst->seqNum + 1;
+        if (fu_busy[inst->opClass])
+            continue;
+        if (inst->squashed) {
+            ready.erase(inst->seqNum);
+            continue;
+        }
+        if (!fus.getUnit(inst->opClass)) {
+            fu_busy[inst->opClass] = true;
+            continue;
+        }
+        ready.erase(inst->seqNum);
+        issued.push_back(inst->seqNum);
+    }
+    return issued;
+}
+
+} // anonymous namespace
+
+/** Instructions are found oldest first, whatever the insertion order. */
+TEST(ReadyListTest, OldestFirst)
+{
+    std::vector<Inst> insts;
+    for (InstSeqNum sn = 1; sn <= 200; sn++)
+        insts.push_back({sn, 0, false});
+
+    std::mt19937 rng(1);
+    std::vector<Inst *> order;
+    for (auto &inst : insts)
+        order.push_back(&inst);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    ReadyList<InstPtr> ready(64);
+    std::set<InstSeqNum> model;
+    for (Inst *inst : order) {
+        ready.insert(inst);
+        model.insert(inst->seqNum);
+        if (rng() % 3 == 0) {
+            InstSeqNum victim = *std::next(model.begin(),
+                                           rng() % model.size());
+            ready.erase(victim);
+            model.erase(victim);
+        }
+    }
+
+    EXPECT_EQ(ready.size(), model.size());
+    auto it = model.begin();
+    for (const InstPtr *inst = ready.findFrom(0); inst;
+         inst = ready.findFrom((*inst)->seqNum + 1)) {
+        ASSERT_NE(it, model.end());
+        EXPECT_EQ((*inst)->seqNum, *it++);
+    }
+    EXPECT_EQ(it, model.end());
+
+    // Searches start at the given sequence number.
+    InstSeqNum from = *std::next(model.begin(), model.size() / 2) - 1;
+    ASSERT_NE(ready.findFrom(from), nullptr);
+    EXPECT_EQ((*ready.findFrom(from))->seqNum, *model.lower_bound(from));
+}
+
+/** The ring grows when the ready instructions span more than its size. */
+TEST(ReadyListTest, Grow)
+{
+    Inst old_inst{10, 0, false};
+    Inst young_inst{10 + 10000, 1, false};
+
+    ReadyList<InstPtr> ready(64);
+    ready.insert(&young_inst);
+    ready.insert(&old_inst);
+
+    ASSERT_EQ(ready.size(), 2u);
+    EXPECT_EQ((*ready.findFrom(0))->seqNum, old_inst.seqNum);
+    EXPECT_EQ((*ready.findFrom(11))->seqNum, young_inst.seqNum);
+    EXPECT_EQ(ready.findFrom(young_inst.seqNum + 1), nullptr);
+}
+
+/**
+ * Scheduling from the ReadyList issues the same instructions in the same
+ * order as the per op class queues, with FUs shared between op classes,
+ * instructions of each class becoming ready out of order, and squashed
+ * instructions.
+ */
+TEST(ReadyListTest, MatchesPerClassQueues)
+{
+    std::mt19937 rng(2);
+    std::vector<std::unique_ptr<Inst>> insts;
+
+    // Two integer units, one of which also does multiplies, a shared
+    // load/store port and a floating point unit.
+    FUs old_fus({0b0011, 0b0001, 0b0100, 0b1000});
+    FUs new_fus({0b0011, 0b0001, 0b0100, 0b1000});
+
+    PerClassScheduler per_class;
+    ReadyList<InstPtr> ready(64);
+    InstSeqNum seq_num = 1;
+    std::vector<Inst *> waiting;
+
+    for (int cycle = 0; cycle < 5000; cycle++) {
+        // Fetch some instructions, and wake some of the waiting ones up
+        // in a random order.
+        for (int i = rng() % 6; i > 0; i--) {
+            insts.emplace_back(new Inst{seq_num++,
+                                        int(rng() % NumOpClasses),
+                                        rng() % 16 == 0});
+            waiting.push_back(insts.back().get());
+        }
+        std::shuffle(waiting.begin(), waiting.end(), rng);
+        for (int i = rng() % 6; i > 0 && !waiting.empty(); i--) {
+            per_class.insert(waiting.back());
+            ready.insert(waiting.back());
+            waiting.pop_back();
+        }
+
+        old_fus.newCycle();
+        new_fus.newCycle();
+        size_t width = 1 + rng() % 8;
+        ASSERT_EQ(per_class.schedule(old_fus, width),
+                  scheduleReadyList(ready, new_fus, width))
+            << "cycle " << cycle;
+    }
+}
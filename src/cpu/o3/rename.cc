@@ -1201,6 +1201,37 @@ Rename::readStallSignals(ThreadID tid)
     }
 }
 
+bool
+Rename::canSkipCycles()
+{
+    ThreadID tid = activeThreads->front();
+
+    if (!insts[tid].empty() || resumeSerialize || resumeUnblocking)
+        return false;
+
+    switch (renameStatus[tid]) {
+      case Blocked:
+        return checkStall(tid);
+      case Running:
+      case Idle:
+        return skidBuffer[tid].empty() && !checkStall(tid);
+      default:
+        return false;
+    }
+}
+
+void
+Rename::skipCycles(Cycles cycles)
+{
+    ThreadID tid = activeThreads->front();
+
+    if (renameStatus[tid] == Blocked) {
+        stats.blockCycles += cycles;
+    } else {
+        stats.idleCycles += cycles;
+    }
+}
+
 bool
 Rename::checkStall(ThreadID tid)
 {
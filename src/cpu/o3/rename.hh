@@ -187,6 +187,14 @@ class Rename
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
+    /** Returns if rename has nothing to do until the stall it is in is
+     * resolved. Only a single thread is considered.
+     */
+    bool canSkipCycles();
+
+    /** Accounts the statistics of cycles skipped while stalled. */
+    void skipCycles(Cycles cycles);
+
     /** Squashes all instructions in a thread. */
     void squash(const InstSeqNum &squash_seq_num, ThreadID tid);
 
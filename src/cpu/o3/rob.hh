@@ -163,6 +163,9 @@ class ROB
     /** Is there any commitable head instruction across all threads ready. */
     bool canCommit();
 
+    /** Accounts the head reads of cycles skipped while commit stalled. */
+    void skipCycles(Cycles cycles) { stats.reads += cycles; }
+
     /** Re-adjust ROB partitioning. */
     void resetEntries();
 
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pc_profiler.hh"
+
+#include <algorithm>
+#include <map>
+
+#include "base/cprintf.hh"
+#include "base/loader/symtab.hh"
+#include "base/output.hh"
+#include "cpu/static_inst.hh"
+#include "params/PCProfiler.hh"
+#include "sim/clocked_object.hh"
+#include "sim/probe/pmu.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+uint64_t
+mixHash(uint64_t hash, Addr addr)
+{
+    hash = (hash ^ addr) * 0x9e3779b97f4a7c15ULL;
+    return hash ^ (hash >> 29);
+}
+
+} // anonymous namespace
+
+PCProfiler::PCProfiler(const PCProfilerParams &p)
+    : ProbeListenerObject(p),
+      sampleInsts(p.sample_insts), sampleCycles(p.sample_cycles),
+      maxDepth(p.max_depth),
+      outputFile(p.output != "" ? p.output : name() + ".folded"),
+      cpu(dynamic_cast<BaseCPU *>(p.manager)), drainedSwitchedOut(false),
+      samplePeriod(0), nextSample(0), instsLeft(p.sample_insts),
+      lostFrames(0), table(1024), used(0)
+{
+    fatal_if(!sampleInsts == !sampleCycles,
+             "%s: Exactly one of sample_insts and sample_cycles must be "
+             "set.", name());
+
+    if (sampleCycles) {
+        auto *clocked = dynamic_cast<ClockedObject *>(p.manager);
+        fatal_if(!clocked, "%s: Sampling cycles needs a clocked manager.",
+                 name());
+        samplePeriod = clocked->cyclesToTicks(Cycles(sampleCycles));
+    }
+
+    callStack.reserve(maxDepth);
+
+    // The destructor is not called on exit, so write the profile from a
+    // callback instead.
+    registerExitCallback([this]() { writeProfile(); });
+}
+
+void
+PCProfiler::regProbeListeners()
+{
+    listeners.push_back(
+        new ProbeListenerArg<PCProfiler, uint64_t>(
+            this, "RetiredInstsPC", &PCProfiler::retiredInstPC));
+    listeners.push_back(
+        new ProbeListenerArg<PCProfiler, BaseCPU::RetiredCtrl>(
+            this, "RetiredCtrl", &PCProfiler::retiredCtrl));
+}
+
+void
+PCProfiler::startup()
+{
+    nextSample = curTick() + samplePeriod;
+}
+
+DrainState
+PCProfiler::drain()
+{
+    drainedSwitchedOut = cpu && cpu->switchedOut();
+    return DrainState::Drained;
+}
+
+void
+PCProfiler::drainResume()
+{
+    // CPUs are switched while the system is drained. Restart sampling
+    // when the CPU is switched in, rather than charging every period
+    // that elapsed while it was switched out to its first instruction.
+    if (drainedSwitchedOut && !cpu->switchedOut())
+        nextSample = curTick() + samplePeriod;
+}
+
+void
+PCProfiler::retiredInstPC(const uint64_t &pc)
+{
+    if (samplePeriod) {
+        if (curTick() < nextSample)
+            return;
+        // Every period that elapsed while nothing retired is charged to
+        // this instruction.
+        const Counter periods = (curTick() - nextSample) / samplePeriod + 1;
+        nextSample += periods * samplePeriod;
+        sample(pc, periods);
+    } else if (--instsLeft == 0) {
+        instsLeft = sampleInsts;
+        sample(pc, 1);
+    }
+}
+
+void
+PCProfiler::retiredCtrl(const BaseCPU::RetiredCtrl &ctrl)
+{
+    if (!ctrl.taken)
+        return;
+
+    if (ctrl.inst->isCall()) {
+        if (callStack.size() < maxDepth)
+            callStack.push_back(ctrl.pc);
+        else
+            lostFrames++;
+    } else if (ctrl.inst->isReturn()) {
+        // Returns without a matching call, e.g. from functions entered
+        // before the CPU started, are ignored.
+        if (lostFrames)
+            lostFrames--;
+        else if (!callStack.empty())
+            callStack.pop_back();
+    }
+}
+
+void
+PCProfiler::sample(Addr pc, Counter weight)
+{
+    uint64_t hash = callStack.size();
+    for (Addr frame : callStack)
+        hash = mixHash(hash, frame);
+    hash = mixHash(hash, pc);
+
+    const uint32_t depth = callStack.size() + 1;
+    const size_t mask = table.size() - 1;
+    size_t idx = hash & mask;
+    for (; table[idx].count; idx = (idx + 1) & mask) {
+        Entry &entry = table[idx];
+        if (entry.hash == hash && entry.depth == depth &&
+            frames[entry.offset + depth - 1] == pc &&
+            std::equal(callStack.begin(), callStack.end(),
+                       frames.begin() + entry.offset)) {
+            entry.count += weight;
+            return;
+        }
+    }
+
+    table[idx] = Entry{hash, uint32_t(frames.size()), depth, weight};
+    frames.insert(frames.end(), callStack.begin(), callStack.end());
+    frames.push_back(pc);
+
+    if (++used * 2 > table.size())
+        grow();
+}
+
+void
+PCProfiler::grow()
+{
+    std::vector<Entry> old_table(table.size() * 2);
+    old_table.swap(table);
+
+    const size_t mask = table.size() - 1;
+    for (const Entry &entry : old_table) {
+        if (!entry.count)
+            continue;
+        size_t idx = entry.hash & mask;
+        while (table[idx].count)
+            idx = (idx + 1) & mask;
+        table[idx] = entry;
+    }
+}
+
+void
+PCProfiler::dump(std::ostream &os) const
+{
+    // Stacks through different call sites of the same functions fold
+    // into the same line.
+    std::map<std::string, Counter> folded;
+    std::string stack;
+    for (const Entry &entry : table) {
+        if (!entry.count)
+            continue;
+
+        stack.clear();
+        for (uint32_t i = 0; i < entry.depth; i++) {
+            const Addr addr = frames[entry.offset + i];
+            auto it = loader::debugSymbolTable.findNearest(addr);
+            if (i)
+                stack += ';';
+            if (it != loader::debugSymbolTable.end())
+                stack += it->name;
+            else
+                stack += csprintf("%#x", addr);
+        }
+        folded[stack] += entry.count;
+    }
+
+    for (const auto &line : folded)
+        ccprintf(os, "%s %d\n", line.first, line.second);
+}
+
+void
+PCProfiler::writeProfile()
+{
+    OutputStream *os = simout.create(outputFile);
+    dump(*os->stream());
+    simout.close(os);
+}
+
+} // namespace gem5
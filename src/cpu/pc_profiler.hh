@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PC_PROFILER_HH__
+#define __CPU_PC_PROFILER_HH__
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/base.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+struct PCProfilerParams;
+
+/**
+ * Sampling profiler for the code running on a CPU of any model. Much like
+ * a performance counter overflow interrupt, it records the PC of a retired
+ * instruction every sample_insts instructions or every sample_cycles
+ * cycles, together with the call stack at that point. Cycle samples are
+ * attributed to the next instruction to retire, so stalls are charged to
+ * the instruction they held up.
+ *
+ * The call stack is shadowed from the calls and returns the CPU retires,
+ * so it is only as good as the guest's call discipline: tail calls,
+ * exceptions and context switches can leave stale frames behind.
+ *
+ * Samples are counted per unique stack in an open addressed hash table
+ * that only allocates when a new stack shows up. Symbols are looked up
+ * in loader::debugSymbolTable when the profile is written at exit, in
+ * the folded stack format read by flame graph tools.
+ */
+class PCProfiler : public ProbeListenerObject
+{
+  public:
+    PCProfiler(const PCProfilerParams &params);
+
+    /** Register the probe listeners. */
+    void regProbeListeners() override;
+
+    void startup() override;
+
+    DrainState drain() override;
+    void drainResume() override;
+
+    /** Write the samples collected so far as folded stacks. */
+    void dump(std::ostream &os) const;
+
+  private:
+    void retiredInstPC(const uint64_t &pc);
+    void retiredCtrl(const BaseCPU::RetiredCtrl &ctrl);
+
+    /** Count weight samples of the current stack ending at pc. */
+    void sample(Addr pc, Counter weight);
+
+    /** Double the size of the sample table. */
+    void grow();
+
+    /** Exit callback writing the profile to the output file. */
+    void writeProfile();
+
+    struct Entry
+    {
+        uint64_t hash;
+        /** Position of the stack in frames. */
+        uint32_t offset;
+        /** Number of frames, including the sampled PC. */
+        uint32_t depth;
+        /** Number of samples, 0 for a free entry. */
+        Counter count;
+    };
+
+    const Counter sampleInsts;
+    const Counter sampleCycles;
+    const unsigned maxDepth;
+    const std::string outputFile;
+
+    /** The CPU retiring the instructions, if the manager is one. */
+    BaseCPU *cpu;
+    /** Whether the CPU was switched out when the system drained. */
+    bool drainedSwitchedOut;
+
+    /** Ticks between cycle samples, 0 if sampling instructions. */
+    Tick samplePeriod;
+    Tick nextSample;
+    Counter instsLeft;
+
+    /** Call sites of the active calls, outermost first. */
+    std::vector<Addr> callStack;
+    /** Active calls deeper than maxDepth, which are not recorded. */
+    unsigned lostFrames;
+
+    std::vector<Entry> table;
+    size_t used;
+    /** The stacks in table, each followed by its sampled PC. */
+    std::vector<Addr> frames;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PC_PROFILER_HH__
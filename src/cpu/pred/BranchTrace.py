@@ -0,0 +1,53 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.SimObject import SimObject
+from m5.params import *
+from m5.objects.Probe import ProbeListenerObject
+
+class BranchTraceProbe(ProbeListenerObject):
+    type = 'BranchTraceProbe'
+    cxx_class = 'gem5::branch_prediction::BranchTraceProbe'
+    cxx_header = "cpu/pred/branch_trace_probe.hh"
+
+    # Boolean to compress the trace or not.
+    trace_compress = Param.Bool(True, "Enable trace compression")
+
+    # branch trace output file, named after the probe by default
+    trace_file = Param.String("", "Branch trace output file")
+
+class BranchTraceReplay(SimObject):
+    type = 'BranchTraceReplay'
+    cxx_class = 'gem5::branch_prediction::BranchTraceReplay'
+    cxx_header = "cpu/pred/branch_trace_replay.hh"
+
+    trace_file = Param.String("Branch trace to replay")
+    predictors = VectorParam.BranchPredictor("Branch predictors to evaluate")
+    jobs = Param.Unsigned(0, "Number of predictors evaluated at the same "
+        "time, each in a worker process, 0 for one per host core")
+
+    # The predictors look their number of threads up from their parent
+    numThreads = Param.Unsigned(1, "Number of threads")
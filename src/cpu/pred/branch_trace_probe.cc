@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/branch_trace_probe.hh"
+
+#include <algorithm>
+#include <limits>
+
+#include "base/output.hh"
+#include "cpu/static_inst.hh"
+#include "params/BranchTraceProbe.hh"
+#include "proto/branch.pb.h"
+#include "sim/probe/pmu.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+BranchTraceProbe::BranchTraceProbe(const BranchTraceProbeParams &p)
+    : ProbeListenerObject(p),
+      traceStream(nullptr),
+      insts(0)
+{
+    std::string filename;
+    if (p.trace_file != "") {
+        // If the trace file is not specified as an absolute path,
+        // append the current simulation output directory
+        filename = simout.resolve(p.trace_file);
+
+        const std::string suffix = ".gz";
+        // If trace_compress has been set, check the suffix. Append
+        // accordingly.
+        if (p.trace_compress &&
+            filename.compare(filename.size() - suffix.size(), suffix.size(),
+                             suffix) != 0)
+            filename = filename + suffix;
+    } else {
+        // Generate a filename from the name of the SimObject. Append .trc
+        // and .gz if we want compression enabled.
+        filename = simout.resolve(name() + ".trc" +
+                                  (p.trace_compress ? ".gz" : ""));
+    }
+
+    traceStream = new ProtoOutputStream(filename);
+
+    // Register a callback to compensate for the destructor not
+    // being called. The callback forces the stream to flush and
+    // closes the output file.
+    registerExitCallback([this]() { closeStreams(); });
+}
+
+void
+BranchTraceProbe::regProbeListeners()
+{
+    listeners.push_back(
+        new ProbeListenerArg<BranchTraceProbe, uint64_t>(
+            this, "RetiredInsts", &BranchTraceProbe::retiredInsts));
+    listeners.push_back(
+        new ProbeListenerArg<BranchTraceProbe, BaseCPU::RetiredCtrl>(
+            this, "RetiredCtrl", &BranchTraceProbe::retiredCtrl));
+}
+
+void
+BranchTraceProbe::startup()
+{
+    ProtoMessage::BranchHeader header_msg;
+    header_msg.set_obj_id(name());
+    traceStream->write(header_msg);
+}
+
+void
+BranchTraceProbe::closeStreams()
+{
+    if (traceStream != NULL)
+        delete traceStream;
+}
+
+void
+BranchTraceProbe::retiredInsts(const uint64_t &count)
+{
+    insts += count;
+}
+
+void
+BranchTraceProbe::retiredCtrl(const BaseCPU::RetiredCtrl &ctrl)
+{
+    uint32_t flags = ProtoMessage::Branch::None;
+    if (ctrl.inst->isCondCtrl())
+        flags |= ProtoMessage::Branch::Cond;
+    if (ctrl.inst->isIndirectCtrl())
+        flags |= ProtoMessage::Branch::Indirect;
+    if (ctrl.inst->isCall())
+        flags |= ProtoMessage::Branch::Call;
+    if (ctrl.inst->isReturn())
+        flags |= ProtoMessage::Branch::Return;
+
+    ProtoMessage::Branch branch_msg;
+    branch_msg.set_pc(ctrl.pc);
+    branch_msg.set_target(ctrl.target);
+    branch_msg.set_flags(flags);
+    branch_msg.set_taken(ctrl.taken);
+    branch_msg.set_insts(std::min<uint64_t>(
+        insts, std::numeric_limits<uint32_t>::max()));
+    traceStream->write(branch_msg);
+
+    insts = 0;
+}
+
+} // namespace branch_prediction
+} // namespace gem5
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_BRANCH_TRACE_PROBE_HH__
+#define __CPU_PRED_BRANCH_TRACE_PROBE_HH__
+
+#include <cstdint>
+
+#include "cpu/base.hh"
+#include "proto/protoio.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+struct BranchTraceProbeParams;
+
+namespace branch_prediction
+{
+
+/**
+ * Writes the control instructions retired by a CPU, of any model, to a
+ * protobuf branch trace that BranchTraceReplay can feed straight into
+ * branch predictors.
+ */
+class BranchTraceProbe : public ProbeListenerObject
+{
+  public:
+    BranchTraceProbe(const BranchTraceProbeParams &params);
+
+    /** Register the probe listeners. */
+    void regProbeListeners() override;
+
+    void startup() override;
+
+  private:
+    void retiredInsts(const uint64_t &count);
+    void retiredCtrl(const BaseCPU::RetiredCtrl &ctrl);
+
+    /**
+     * Callback to flush and close all open output streams on exit. If
+     * we were calling the destructor it could be done there.
+     */
+    void closeStreams();
+
+    /** Trace output stream */
+    ProtoOutputStream *traceStream;
+
+    /** Instructions retired since the last branch was written */
+    uint64_t insts;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_BRANCH_TRACE_PROBE_HH__
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/branch_trace_replay.hh"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <thread>
+
+#include "arch/pcstate.hh"
+#include "base/atomicio.hh"
+#include "base/logging.hh"
+#include "cpu/pred/bpred_unit.hh"
+#include "params/BranchTraceReplay.hh"
+#include "proto/branch.pb.h"
+#include "proto/protoio.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+namespace
+{
+
+/** Calls are shorter than this on every ISA. */
+constexpr Addr MaxCallSize = 16;
+
+/**
+ * Stands in for the control instructions of the trace. Predictors only
+ * look at the flags, and at the PC for building return addresses.
+ */
+class TraceBranchInst : public StaticInst
+{
+  public:
+    TraceBranchInst(uint8_t branch_flags)
+        : StaticInst("branch", No_OpClass)
+    {
+        const bool cond = branch_flags & ProtoMessage::Branch::Cond;
+        const bool indirect = branch_flags & ProtoMessage::Branch::Indirect;
+
+        flags[IsControl] = true;
+        flags[IsCondControl] = cond;
+        flags[IsUncondControl] = !cond;
+        flags[IsIndirectControl] = indirect;
+        flags[IsDirectControl] = !indirect;
+        flags[IsCall] = branch_flags & ProtoMessage::Branch::Call;
+        flags[IsReturn] = branch_flags & ProtoMessage::Branch::Return;
+    }
+
+    Fault
+    execute(ExecContext *xc, Trace::InstRecord *traceData) const override
+    {
+        panic("Branches of a trace can't be executed.\n");
+    }
+
+    void
+    advancePC(TheISA::PCState &pc_state) const override
+    {
+        pc_state.advance();
+    }
+
+    TheISA::PCState
+    buildRetPC(const TheISA::PCState &cur_pc,
+               const TheISA::PCState &call_pc) const override
+    {
+        TheISA::PCState ret_pc = call_pc;
+        ret_pc.advance();
+        return ret_pc;
+    }
+
+    std::string
+    generateDisassembly(Addr pc,
+            const loader::SymbolTable *symtab) const override
+    {
+        return mnemonic;
+    }
+};
+
+const char *branchClassNames[] = {
+    "CondDirect",
+    "CondIndirect",
+    "UncondDirect",
+    "UncondIndirect",
+    "Call",
+    "Return",
+};
+
+} // anonymous namespace
+
+BranchTraceReplay::BranchTraceReplay(const BranchTraceReplayParams &p)
+    : SimObject(p),
+      traceFile(p.trace_file),
+      predictors(p.predictors),
+      jobs(p.jobs ? p.jobs : std::max(std::thread::hardware_concurrency(),
+                                      1u)),
+      replayEvent([this]{ replayAll(); }, name()),
+      stats(this)
+{
+    fatal_if(predictors.empty(), "%s: No branch predictor to evaluate.\n",
+             name());
+
+    for (uint8_t flags = 0; flags <= ProtoMessage::Branch::Cond +
+             ProtoMessage::Branch::Indirect + ProtoMessage::Branch::Call +
+             ProtoMessage::Branch::Return; ++flags) {
+        branchInsts.push_back(new TraceBranchInst(flags));
+    }
+
+    for (auto bp : predictors) {
+        const std::string &bp_name = bp->name();
+        stats.predictors.emplace_back(new PredictorStats(&stats,
+            bp_name.substr(bp_name.rfind('.') + 1), stats.insts));
+    }
+}
+
+void
+BranchTraceReplay::init()
+{
+    SimObject::init();
+
+    loadTrace();
+}
+
+void
+BranchTraceReplay::startup()
+{
+    schedule(replayEvent, curTick());
+}
+
+void
+BranchTraceReplay::loadTrace()
+{
+    ProtoInputStream trace_stream(traceFile);
+
+    ProtoMessage::BranchHeader header_msg;
+    fatal_if(!trace_stream.read(header_msg),
+             "Failed to read the header of branch trace %s.\n", traceFile);
+    fatal_if(header_msg.ver() != 0,
+             "Unsupported version %d of branch trace %s.\n",
+             header_msg.ver(), traceFile);
+
+    // Calls which have not returned yet
+    std::vector<size_t> calls;
+
+    ProtoPrefetchStream<ProtoMessage::Branch> branch_stream(trace_stream);
+    ProtoMessage::Branch branch_msg;
+    while (branch_stream.read(branch_msg)) {
+        Branch branch;
+        branch.pc = branch_msg.pc();
+        branch.target = branch_msg.target();
+        branch.taken = branch_msg.taken();
+        branch.fallThrough = branch.taken ? 0 : branch.target;
+        branch.flags = branch_msg.flags() & (branchInsts.size() - 1);
+
+        const bool cond = branch.flags & ProtoMessage::Branch::Cond;
+        const bool indirect =
+            branch.flags & ProtoMessage::Branch::Indirect;
+        if (branch.flags & ProtoMessage::Branch::Return) {
+            branch.branchClass = Return;
+        } else if (branch.flags & ProtoMessage::Branch::Call) {
+            branch.branchClass = Call;
+        } else if (cond) {
+            branch.branchClass = indirect ? CondIndirect : CondDirect;
+        } else {
+            branch.branchClass = indirect ? UncondIndirect : UncondDirect;
+        }
+
+        // A call falls through to where the matching return goes back to,
+        // as the trace has no instruction sizes
+        if (branch.flags & ProtoMessage::Branch::Call) {
+            calls.push_back(trace.size());
+        } else if ((branch.flags & ProtoMessage::Branch::Return) &&
+                   !calls.empty()) {
+            Branch &call = trace[calls.back()];
+            calls.pop_back();
+            if (branch.target > call.pc &&
+                branch.target - call.pc <= MaxCallSize) {
+                call.fallThrough = branch.target;
+            }
+        }
+
+        trace.push_back(branch);
+        numInsts += branch_msg.insts();
+    }
+}
+
+BranchTraceReplay::Result
+BranchTraceReplay::replay(BPredUnit *bp) const
+{
+    Result result = {};
+    InstSeqNum seq_num = 0;
+
+    for (const auto &branch : trace) {
+        TheISA::PCState pc(branch.pc);
+        if (branch.fallThrough)
+            pc.npc(branch.fallThrough);
+
+        // Resolve and retire every branch right away, as if nothing else
+        // were in flight
+        ++seq_num;
+        bool pred_taken = bp->predict(branchInsts[branch.flags], seq_num,
+                                      pc, 0);
+        if (pred_taken != branch.taken || pc.instAddr() != branch.target) {
+            bp->squash(seq_num, TheISA::PCState(branch.target),
+                       branch.taken, 0);
+            ++result.mispredicts[branch.branchClass];
+        }
+        bp->update(seq_num, 0);
+
+        ++result.branches[branch.branchClass];
+    }
+
+    return result;
+}
+
+void
+BranchTraceReplay::replayAll()
+{
+    struct Worker
+    {
+        pid_t pid;
+        int fd;
+        size_t predictor;
+    };
+    std::deque<Worker> workers;
+    size_t next = 0;
+
+    stats.insts = numInsts;
+
+    while (next < predictors.size() || !workers.empty()) {
+        while (next < predictors.size() && workers.size() < jobs) {
+            int fds[2];
+            fatal_if(pipe(fds) != 0, "%s: Failed to create a pipe: %s.\n",
+                     name(), std::strerror(errno));
+
+            // Don't let the workers inherit pending output
+            std::cout.flush();
+            std::cerr.flush();
+            std::fflush(nullptr);
+
+            pid_t pid = fork();
+            fatal_if(pid < 0, "%s: Failed to fork a worker: %s.\n", name(),
+                     std::strerror(errno));
+            if (pid == 0) {
+                close(fds[0]);
+                Result result = replay(predictors[next]);
+                ssize_t len = atomic_write(fds[1], &result, sizeof(result));
+                _exit(len == sizeof(result) ? 0 : 1);
+            }
+
+            close(fds[1]);
+            workers.push_back({pid, fds[0], next++});
+        }
+
+        const Worker worker = workers.front();
+        workers.pop_front();
+
+        Result result;
+        ssize_t len = atomic_read(worker.fd, &result, sizeof(result));
+        close(worker.fd);
+
+        int status;
+        while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR);
+        fatal_if(len != sizeof(result) || !WIFEXITED(status) ||
+                 WEXITSTATUS(status) != 0,
+                 "%s: Replaying the trace through %s failed.\n", name(),
+                 predictors[worker.predictor]->name());
+
+        PredictorStats &bp_stats = *stats.predictors[worker.predictor];
+        for (int i = 0; i < NumBranchClasses; ++i) {
+            bp_stats.branches[i] += result.branches[i];
+            bp_stats.mispredicts[i] += result.mispredicts[i];
+        }
+    }
+
+    exitSimLoop("branch trace replayed");
+}
+
+BranchTraceReplay::PredictorStats::PredictorStats(
+        statistics::Group *parent, const std::string &name,
+        const statistics::Scalar &insts)
+    : statistics::Group(parent, name.c_str()),
+      ADD_STAT(branches, statistics::units::Count::get(),
+               "Number of branches replayed"),
+      ADD_STAT(mispredicts, statistics::units::Count::get(),
+               "Number of branches mispredicted"),
+      ADD_STAT(mpki, statistics::units::Ratio::get(),
+               "Mispredictions per kilo instruction",
+               mispredicts * 1000 / insts),
+      ADD_STAT(totalMpki, statistics::units::Ratio::get(),
+               "Mispredictions per kilo instruction over all branches",
+               sum(mispredicts) * 1000 / insts)
+{
+    branches.init(NumBranchClasses);
+    mispredicts.init(NumBranchClasses);
+    for (int i = 0; i < NumBranchClasses; ++i) {
+        branches.subname(i, branchClassNames[i]);
+        mispredicts.subname(i, branchClassNames[i]);
+        mpki.subname(i, branchClassNames[i]);
+    }
+    mpki.precision(4);
+    totalMpki.precision(4);
+}
+
+BranchTraceReplay::ReplayStats::ReplayStats(BranchTraceReplay *replay)
+    : statistics::Group(replay),
+      ADD_STAT(insts, statistics::units::Count::get(),
+               "Number of instructions covered by the trace")
+{
+}
+
+} // namespace branch_prediction
+} // namespace gem5
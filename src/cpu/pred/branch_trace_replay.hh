@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_BRANCH_TRACE_REPLAY_HH__
+#define __CPU_PRED_BRANCH_TRACE_REPLAY_HH__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+struct BranchTraceReplayParams;
+
+namespace branch_prediction
+{
+
+class BPredUnit;
+
+/**
+ * Replays a branch trace written by BranchTraceProbe through a set of
+ * branch predictors, without simulating a CPU, and reports mispredictions
+ * per kilo instruction for each class of branches.
+ *
+ * The trace is decoded once, then every predictor replays it in a worker
+ * process of its own. The predictors share global state, such as the
+ * random number generator, so separate processes keep them from
+ * interfering. They also keep the results independent of how many run
+ * concurrently. The statistics of the predictors themselves stay empty,
+ * only the statistics of the replay are reported.
+ */
+class BranchTraceReplay : public SimObject
+{
+  public:
+    BranchTraceReplay(const BranchTraceReplayParams &params);
+
+    void init() override;
+    void startup() override;
+
+  private:
+    /** Classes of branches the results are broken down by. */
+    enum BranchClass
+    {
+        CondDirect,
+        CondIndirect,
+        UncondDirect,
+        UncondIndirect,
+        Call,
+        Return,
+        NumBranchClasses
+    };
+
+    /** A decoded branch of the trace. */
+    struct Branch
+    {
+        Addr pc;
+        Addr target;
+        /**
+         * Address of the sequentially next instruction, if known. It is
+         * what calls push on the return address stack.
+         */
+        Addr fallThrough;
+        uint8_t flags;
+        uint8_t branchClass;
+        bool taken;
+    };
+
+    /** Counts a worker sends back for one predictor. */
+    struct Result
+    {
+        uint64_t branches[NumBranchClasses];
+        uint64_t mispredicts[NumBranchClasses];
+    };
+
+    /** Decode the whole trace into memory. */
+    void loadTrace();
+
+    /** Replay the trace through one predictor. */
+    Result replay(BPredUnit *bp) const;
+
+    /** Replay the trace through all the predictors, then exit. */
+    void replayAll();
+
+    /** Trace file to replay */
+    const std::string traceFile;
+
+    /** Predictors to evaluate */
+    const std::vector<BPredUnit *> predictors;
+
+    /** Maximum number of worker processes running at a time */
+    unsigned jobs;
+
+    /** The decoded trace */
+    std::vector<Branch> trace;
+
+    /** Instructions covered by the trace */
+    uint64_t numInsts = 0;
+
+    /** One static instruction per combination of branch flags */
+    std::vector<StaticInstPtr> branchInsts;
+
+    EventFunctionWrapper replayEvent;
+
+    struct PredictorStats : public statistics::Group
+    {
+        PredictorStats(statistics::Group *parent, const std::string &name,
+                       const statistics::Scalar &insts);
+
+        /** Branches replayed, by class */
+        statistics::Vector branches;
+        /** Mispredicted branches, by class */
+        statistics::Vector mispredicts;
+        /** Mispredictions per kilo instruction, by class */
+        statistics::Formula mpki;
+        /** Mispredictions per kilo instruction over all branches */
+        statistics::Formula totalMpki;
+    };
+
+    struct ReplayStats : public statistics::Group
+    {
+        ReplayStats(BranchTraceReplay *replay);
+
+        /** Instructions covered by the trace */
+        statistics::Scalar insts;
+
+        std::vector<std::unique_ptr<PredictorStats>> predictors;
+    } stats;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_BRANCH_TRACE_REPLAY_HH__
@@ -39,6 +39,7 @@
 #include "cpu/pred/multiperspective_perceptron.hh"
 
 #include "base/random.hh"
+#include "cpu/pred/weight_sum.hh"
 #include "debug/Branch.hh"
 
 namespace gem5
@@ -106,13 +107,12 @@ MultiperspectivePerceptron::ThreadData::ThreadData(int num_filters,
 
     for (int i = 0; i < table_sizes.size(); i += 1) {
         mpreds.push_back(0);
-        tables.push_back(std::vector<short int>(table_sizes[i]));
-        sign_bits.push_back(std::vector<std::array<bool, 2>>(table_sizes[i]));
-        for (int j = 0; j < table_sizes[i]; j += 1) {
-            for (int k = 0; k < n_sign_bits; k += 1) {
-                sign_bits[i][j][k] = (i & 1) | (k & 1);
-            }
+        tables.addTable(table_sizes[i]);
+        std::array<bool, 2> init_sign = {};
+        for (int k = 0; k < n_sign_bits; k += 1) {
+            init_sign[k] = (i & 1) | (k & 1);
         }
+        sign_bits.addTable(table_sizes[i], init_sign);
     }
 }
 
@@ -310,7 +310,8 @@ int
 MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
 {
     // list of best predictors
-    std::vector<int> best_preds(specs.size(), -1);
+    std::vector<int> &best_preds = bestPreds;
+    best_preds.assign(specs.size(), -1);
 
     // initialize sum
     bi.yout = 0;
@@ -331,39 +332,36 @@ MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
     // find the best subset of features to use in case of a low-confidence
     // branch
     findBest(tid, best_preds);
+    isBest.assign(specs.size(), 0);
+    if (threshold >= 0) {
+        for (int j = 0; j < std::min(nbest, (int) best_preds.size()); j += 1) {
+            isBest[best_preds[j]] = 1;
+        }
+    }
 
-    // begin computation of the sum for low-confidence branch
-    int bestval = 0;
-
+    // gather the weights of the features
+    const ThreadData &td = *threadData[tid];
+    const unsigned int sign_idx = bi.getHPC() % n_sign_bits;
+    weightMagnitudes.resize(specs.size());
+    weightSigns.resize(specs.size());
     for (int i = 0; i < specs.size(); i += 1) {
         HistorySpec const &spec = *specs[i];
         // get the hash to index the table
         unsigned int hashed_idx = getIndex(tid, bi, spec, i);
-        // add the weight; first get the weight's magnitude
-        int counter = threadData[tid]->tables[i][hashed_idx];
-        // get the sign
-        bool sign =
-          threadData[tid]->sign_bits[i][hashed_idx][bi.getHPC() % n_sign_bits];
+        // get the weight's magnitude
+        int counter = td.tables[i][hashed_idx];
         // apply the transfer function and multiply by a coefficient
-        int weight = spec.coeff * ((spec.width == 5) ?
-                                   xlat4[counter] : xlat[counter]);
-        // apply the sign
-        int val = sign ? -weight : weight;
-        // add the value
-        bi.yout += val;
-        // if this is one of those good features, add the value to bestval
-        if (threshold >= 0) {
-            for (int j = 0;
-                 j < std::min(nbest, (int) best_preds.size());
-                 j += 1)
-            {
-                if (best_preds[j] == i) {
-                    bestval += val;
-                    break;
-                }
-            }
-        }
+        weightMagnitudes[i] = spec.coeff * ((spec.width == 5) ?
+                                            xlat4[counter] : xlat[counter]);
+        // get the sign
+        weightSigns[i] = td.sign_bits[i][hashed_idx][sign_idx];
     }
+
+    // add the signed weights, and separately the weights of the good
+    // features for low-confidence branches
+    int bestval = 0;
+    bi.yout += sumWeights(weightMagnitudes.data(), weightSigns.data(),
+                          isBest.data(), specs.size(), bestval);
     // apply a fudge factor to affect when training is triggered
     bi.yout *= fudge;
     return bestval;
@@ -409,24 +407,37 @@ MultiperspectivePerceptron::satIncDec(bool taken, bool &sign, int &counter,
 void
 MultiperspectivePerceptron::train(ThreadID tid, MPPBranchInfo &bi, bool taken)
 {
-    std::vector<std::vector<short int>> &tables = threadData[tid]->tables;
-    std::vector<std::vector<std::array<bool, 2>>> &sign_bits =
-            threadData[tid]->sign_bits;
+    PackedTables<short int> &tables = threadData[tid]->tables;
+    PackedTables<std::array<bool, 2>> &sign_bits = threadData[tid]->sign_bits;
     std::vector<int> &mpreds = threadData[tid]->mpreds;
     // was the prediction correct?
     bool correct = (bi.yout >= 1) == taken;
     // what is the magnitude of yout?
     int abs_yout = abs(bi.yout);
+    // if the branch was predicted incorrectly or the correct
+    // prediction was weak, update the weights
+    bool do_train = !correct || (abs_yout <= theta);
+    bool do_tune = threshold >= 0 && (!tuneonly || (abs_yout <= threshold));
+    if (!do_tune && !do_train) return;
+
+    // the histories do not change while training, so hash the table
+    // indices only once
+    std::vector<unsigned int> &hashed_indices = hashedIndices;
+    hashed_indices.resize(specs.size());
+    for (int i = 0; i < specs.size(); i += 1) {
+        hashed_indices[i] = getIndex(tid, bi, *specs[i], i);
+    }
+    const unsigned int sign_idx = bi.getHPC() % n_sign_bits;
+
     // keep track of mispredictions per table
-    if (threshold >= 0) if (!tuneonly || (abs_yout <= threshold)) {
+    if (do_tune) {
         bool halve = false;
 
         // for each table, figure out if there was a misprediction
         for (int i = 0; i < specs.size(); i += 1) {
             HistorySpec const &spec = *specs[i];
-            // get the hash to index the table
-            unsigned int hashed_idx = getIndex(tid, bi, spec, i);
-            bool sign = sign_bits[i][hashed_idx][bi.getHPC() % n_sign_bits];
+            unsigned int hashed_idx = hashed_indices[i];
+            bool sign = sign_bits[i][hashed_idx][sign_idx];
             int counter = tables[i][hashed_idx];
             int weight = spec.coeff * ((spec.width == 5) ?
                                        xlat4[counter] : xlat[counter]);
@@ -446,9 +457,6 @@ MultiperspectivePerceptron::train(ThreadID tid, MPPBranchInfo &bi, bool taken)
             }
         }
     }
-    // if the branch was predicted incorrectly or the correct
-    // prediction was weak, update the weights
-    bool do_train = !correct || (abs_yout <= theta);
     if (!do_train) return;
 
     // adaptive theta training, adapted from O-GEHL
@@ -473,15 +481,15 @@ MultiperspectivePerceptron::train(ThreadID tid, MPPBranchInfo &bi, bool taken)
     for (int i = 0; i < specs.size(); i += 1) {
         HistorySpec const &spec = *specs[i];
         // get the magnitude
-        unsigned int hashed_idx = getIndex(tid, bi, spec, i);
+        unsigned int hashed_idx = hashed_indices[i];
         int counter = tables[i][hashed_idx];
         // get the sign
-        bool sign = sign_bits[i][hashed_idx][bi.getHPC() % n_sign_bits];
+        bool sign = sign_bits[i][hashed_idx][sign_idx];
         // increment/decrement if taken/not taken
         satIncDec(taken, sign, counter, (1 << (spec.width - 1)) - 1);
         // update the magnitude and sign
         tables[i][hashed_idx] = counter;
-        sign_bits[i][hashed_idx][bi.getHPC() % n_sign_bits] = sign;
+        sign_bits[i][hashed_idx][sign_idx] = sign;
         int weight = ((spec.width == 5) ? xlat4[counter] : xlat[counter]);
         // update the new version of yout
         if (sign) {
@@ -507,10 +515,9 @@ MultiperspectivePerceptron::train(ThreadID tid, MPPBranchInfo &bi, bool taken)
                 for (int j = 0; j < specs.size(); j += 1) {
                     int i = (nrand + j) % specs.size();
                     HistorySpec const &spec = *specs[i];
-                    unsigned int hashed_idx = getIndex(tid, bi, spec, i);
+                    unsigned int hashed_idx = hashed_indices[i];
                     int counter = tables[i][hashed_idx];
-                    bool sign =
-                        sign_bits[i][hashed_idx][bi.getHPC() % n_sign_bits];
+                    bool sign = sign_bits[i][hashed_idx][sign_idx];
                     int weight = ((spec.width == 5) ?
                             xlat4[counter] : xlat[counter]);
                     int signed_weight = sign ? -weight : weight;
@@ -525,10 +532,9 @@ MultiperspectivePerceptron::train(ThreadID tid, MPPBranchInfo &bi, bool taken)
                 if (besti != -1) {
                     int i = besti;
                     HistorySpec const &spec = *specs[i];
-                    unsigned int hashed_idx = getIndex(tid, bi, spec, i);
+                    unsigned int hashed_idx = hashed_indices[i];
                     int counter = tables[i][hashed_idx];
-                    bool sign =
-                        sign_bits[i][hashed_idx][bi.getHPC() % n_sign_bits];
+                    bool sign = sign_bits[i][hashed_idx][sign_idx];
                     if (counter > 1) {
                         counter--;
                         tables[i][hashed_idx] = counter;
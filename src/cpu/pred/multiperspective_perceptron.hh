@@ -294,6 +294,33 @@ class MultiperspectivePerceptron : public BPredUnit
     /** Transfer function for 5-width tables */
     static int xlat4[];
 
+    /**
+     * Set of predictor tables stored back to back in a single vector,
+     * table i is accessed through operator[](i)
+     */
+    template <typename T>
+    class PackedTables
+    {
+        std::vector<T> entries;
+        std::vector<size_t> offsets;
+
+      public:
+        /** Appends a table of the given size */
+        void
+        addTable(size_t size, const T &init = T())
+        {
+            offsets.push_back(entries.size());
+            entries.resize(entries.size() + size, init);
+        }
+
+        T *operator[](int table) { return &entries[offsets[table]]; }
+        const T *
+        operator[](int table) const
+        {
+            return &entries[offsets[table]];
+        }
+    };
+
     /** History data is kept for each thread */
     struct ThreadData
     {
@@ -353,8 +380,8 @@ class MultiperspectivePerceptron : public BPredUnit
         int occupancy;
 
         std::vector<int> mpreds;
-        std::vector<std::vector<short int>> tables;
-        std::vector<std::vector<std::array<bool, 2>>> sign_bits;
+        PackedTables<short int> tables;
+        PackedTables<std::array<bool, 2>> sign_bits;
     };
     std::vector<ThreadData *> threadData;
 
@@ -362,6 +389,14 @@ class MultiperspectivePerceptron : public BPredUnit
     std::vector<HistorySpec *> specs;
     std::vector<int> table_sizes;
 
+    /** Scratch storage reused across predictions */
+    std::vector<int> bestPreds;
+    std::vector<uint8_t> isBest;
+    std::vector<unsigned int> hashedIndices;
+    /** Weights gathered from the tables, see sumWeights() */
+    std::vector<int> weightMagnitudes;
+    std::vector<uint8_t> weightSigns;
+
     /** runtime values and data used to count the size in bits */
     bool doing_local;
     bool doing_recency;
@@ -41,6 +41,7 @@
 
 #include "cpu/pred/statistical_corrector.hh"
 
+#include "cpu/pred/weight_sum.hh"
 #include "params/StatisticalCorrector.hh"
 
 namespace gem5
@@ -194,13 +195,13 @@ StatisticalCorrector::gPredict(Addr branch_pc, int64_t hist,
         std::vector<int> & length, std::vector<int8_t> * tab, int nbr,
         int logs, std::vector<int8_t> & w)
 {
-    int percsum = 0;
+    gCounters.resize(nbr);
     for (int i = 0; i < nbr; i++) {
         int64_t bhist = hist & ((int64_t) ((1 << length[i]) - 1));
         int64_t index = gIndex(branch_pc, bhist, logs, nbr, i);
-        int8_t ctr = tab[i][index];
-        percsum += (2 * ctr + 1);
+        gCounters[i] = tab[i][index];
     }
+    int percsum = sumCenteredCounters(gCounters.data(), nbr);
     percsum = (1 + (w[getIndUpds(branch_pc)] >= 0)) * percsum;
     return percsum;
 }
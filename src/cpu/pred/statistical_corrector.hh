@@ -189,6 +189,9 @@ class StatisticalCorrector : public SimObject
     int8_t firstH;
     int8_t secondH;
 
+    /** Counters gathered by gPredict(), see sumCenteredCounters() */
+    std::vector<int8_t> gCounters;
+
     struct StatisticalCorrectorStats : public statistics::Group
     {
         StatisticalCorrectorStats(statistics::Group *parent);
@@ -135,9 +135,9 @@ TAGEBase::init()
     }
 
     const uint64_t bimodalTableSize = 1ULL << logTagTableSizes[0];
-    btablePrediction.resize(bimodalTableSize, false);
+    btablePrediction.resize(bimodalTableSize, 0);
     btableHysteresis.resize(bimodalTableSize >> logRatioBiModalHystEntries,
-                            true);
+                            1);
 
     gtable = new TageEntry*[nHistoryTables + 1];
     buildTageTables();
@@ -165,8 +165,15 @@ TAGEBase::initFoldedHistories(ThreadHistory & history)
 void
 TAGEBase::buildTageTables()
 {
+    // Allocate the tables back to back
+    size_t num_entries = 0;
     for (int i = 1; i <= nHistoryTables; i++) {
-        gtable[i] = new TageEntry[1<<(logTagTableSizes[i])];
+        num_entries += 1<<(logTagTableSizes[i]);
+    }
+    TageEntry *entries = new TageEntry[num_entries];
+    for (int i = 1; i <= nHistoryTables; i++) {
+        gtable[i] = entries;
+        entries += 1<<(logTagTableSizes[i]);
     }
 }
 
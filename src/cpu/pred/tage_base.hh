@@ -71,13 +71,13 @@ class TAGEBase : public SimObject
   protected:
     // Prediction Structures
 
-    // Tage Entry
+    // Tage Entry, packed into 4 bytes
     struct TageEntry
     {
-        int8_t ctr;
         uint16_t tag;
+        int8_t ctr;
         uint8_t u;
-        TageEntry() : ctr(0), tag(0), u(0) { }
+        TageEntry() : tag(0), ctr(0), u(0) { }
     };
 
     // Folded History Table - compressed history
@@ -86,10 +86,10 @@ class TAGEBase : public SimObject
     struct FoldedHistory
     {
         unsigned comp;
+        unsigned compMask;
         int compLength;
         int origLength;
         int outpoint;
-        int bufferSize;
 
         FoldedHistory()
         {
@@ -101,6 +101,7 @@ class TAGEBase : public SimObject
             origLength = original_length;
             compLength = compressed_length;
             outpoint = original_length % compressed_length;
+            compMask = (1ULL << compressed_length) - 1;
         }
 
         void update(uint8_t * h)
@@ -108,7 +109,7 @@ class TAGEBase : public SimObject
             comp = (comp << 1) | h[0];
             comp ^= h[origLength] << outpoint;
             comp ^= (comp >> compLength);
-            comp &= (1ULL << compLength) - 1;
+            comp &= compMask;
         }
     };
 
@@ -433,8 +434,11 @@ class TAGEBase : public SimObject
     std::vector<unsigned> tagTableTagWidths;
     std::vector<int> logTagTableSizes;
 
-    std::vector<bool> btablePrediction;
-    std::vector<bool> btableHysteresis;
+    // Bimodal tables, a byte per entry avoids the bit manipulation of
+    // std::vector<bool>
+    std::vector<uint8_t> btablePrediction;
+    std::vector<uint8_t> btableHysteresis;
+    // Tagged tables, each pointing into a single allocation
     TageEntry **gtable;
 
     // Keep per-thread histories to
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_WEIGHT_SUM_HH__
+#define __CPU_PRED_WEIGHT_SUM_HH__
+
+#include <cstdint>
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+/**
+ * @file
+ * Sums of the weights of perceptron-like predictors. The weights read
+ * from the tables are first gathered in contiguous arrays, so that the
+ * loops summing them have neither indirect accesses nor branches, and
+ * are vectorized by the compiler. The sums are of integers, so they do
+ * not depend on the order of the additions, and are the same as adding
+ * each weight as it is read from its table.
+ */
+
+/**
+ * Sums the signed weights of a perceptron, and the weights of a subset
+ * of its features.
+ *
+ * @param magnitudes Magnitude of each weight.
+ * @param negative 1 if the weight is negative, 0 otherwise.
+ * @param selected 1 if the feature is in the subset, 0 otherwise.
+ * @param count Number of weights.
+ * @param selected_sum Set to the sum of the weights in the subset.
+ * @return The sum of all the weights.
+ */
+inline int
+sumWeights(const int *magnitudes, const uint8_t *negative,
+           const uint8_t *selected, int count, int &selected_sum)
+{
+    int sum = 0;
+    int partial = 0;
+    for (int i = 0; i < count; i++) {
+        // All ones for negative weights, so that the xor and subtraction
+        // negate the magnitude
+        const int neg = -int(negative[i]);
+        const int val = (magnitudes[i] ^ neg) - neg;
+        sum += val;
+        partial += val & -int(selected[i]);
+    }
+    selected_sum = partial;
+    return sum;
+}
+
+/**
+ * Sums signed counters used as weights centered on zero, i.e.,
+ * 2 * ctr + 1 each, as the statistical corrector does.
+ */
+inline int
+sumCenteredCounters(const int8_t *counters, int count)
+{
+    int sum = 0;
+    for (int i = 0; i < count; i++)
+        sum += 2 * counters[i] + 1;
+    return sum;
+}
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_WEIGHT_SUM_HH__
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "cpu/pred/weight_sum.hh"
+
+using namespace gem5;
+using namespace gem5::branch_prediction;
+
+namespace
+{
+
+/** A feature of a perceptron: its table, coefficient and counter width */
+struct Feature
+{
+    std::vector<short int> counters;
+    std::vector<std::array<bool, 2>> signs;
+    int coeff;
+    int width;
+};
+
+} // anonymous namespace
+
+/**
+ * The perceptron output computed from the gathered weights is the same
+ * as the one of the scalar loop of
+ * MultiperspectivePerceptron::computeOutput(), which sums each weight as
+ * it is read from its table.
+ */
+TEST(WeightSumTest, MatchesPerceptronLoop)
+{
+    std::mt19937 rng(1);
+    // Transfer functions of the 6 and 5-bit counters
+    std::vector<int> xlat(64), xlat4(32);
+    for (auto &v : xlat)
+        v = rng() % 512;
+    for (auto &v : xlat4)
+        v = rng() % 512;
+
+    std::vector<Feature> features(37);
+    for (auto &feature : features) {
+        feature.width = rng() % 2 ? 5 : 6;
+        feature.coeff = 1 + rng() % 3;
+        feature.counters.resize(1 + rng() % 1024);
+        feature.signs.resize(feature.counters.size());
+        for (size_t i = 0; i < feature.counters.size(); i++) {
+            feature.counters[i] = rng() % (1 << (feature.width - 1));
+            feature.signs[i] = {bool(rng() % 2), bool(rng() % 2)};
+        }
+    }
+
+    std::vector<int> magnitudes(features.size());
+    std::vector<uint8_t> negative(features.size());
+    std::vector<uint8_t> selected(features.size());
+    for (int n = 0; n < 10000; n++) {
+        const unsigned sign_idx = rng() % 2;
+        std::vector<unsigned> indices;
+        for (size_t i = 0; i < features.size(); i++) {
+            indices.push_back(rng() % features[i].counters.size());
+            selected[i] = rng() % 4 == 0;
+        }
+
+        int yout = 0, bestval = 0;
+        for (size_t i = 0; i < features.size(); i++) {
+            const Feature &f = features[i];
+            int counter = f.counters[indices[i]];
+            bool sign = f.signs[indices[i]][sign_idx];
+            int weight = f.coeff * ((f.width == 5) ?
+                                    xlat4[counter] : xlat[counter]);
+            int val = sign ? -weight : weight;
+            yout += val;
+            if (selected[i])
+                bestval += val;
+        }
+
+        for (size_t i = 0; i < features.size(); i++) {
+            const Feature &f = features[i];
+            int counter = f.counters[indices[i]];
+            magnitudes[i] = f.coeff * ((f.width == 5) ?
+                                       xlat4[counter] : xlat[counter]);
+            negative[i] = f.signs[indices[i]][sign_idx];
+        }
+        int selected_sum = -1;
+        ASSERT_EQ(sumWeights(magnitudes.data(), negative.data(),
+                             selected.data(), features.size(),
+                             selected_sum), yout);
+        ASSERT_EQ(selected_sum, bestval);
+    }
+}
+
+/** Weights of both signs and at the extremes of their range. */
+TEST(WeightSumTest, Extremes)
+{
+    const int magnitudes[] = {0, 0, 1, 1, 32767, 32767, 12, 7};
+    const uint8_t negative[] = {0, 1, 0, 1, 0, 1, 1, 0};
+    const uint8_t selected[] = {1, 1, 0, 1, 1, 0, 0, 1};
+    int selected_sum = 0;
+
+    EXPECT_EQ(sumWeights(magnitudes, negative, selected, 8, selected_sum),
+              1 - 1 + 32767 - 32767 - 12 + 7);
+    EXPECT_EQ(selected_sum, -1 + 32767 + 7);
+
+    EXPECT_EQ(sumWeights(magnitudes, negative, selected, 0, selected_sum),
+              0);
+    EXPECT_EQ(selected_sum, 0);
+}
+
+/**
+ * The sum of the gathered counters is the same as the one of the scalar
+ * loop of StatisticalCorrector::gPredict().
+ */
+TEST(WeightSumTest, MatchesCorrectorLoop)
+{
+    std::mt19937 rng(2);
+    for (int n = 0; n < 10000; n++) {
+        std::vector<int8_t> counters(1 + rng() % 16);
+        for (auto &ctr : counters)
+            ctr = int8_t(rng() % 256);
+
+        int percsum = 0;
+        for (size_t i = 0; i < counters.size(); i++) {
+            int8_t ctr = counters[i];
+            percsum += (2 * ctr + 1);
+        }
+        ASSERT_EQ(sumCenteredCounters(counters.data(), counters.size()),
+                  percsum);
+    }
+}
@@ -60,6 +60,12 @@ class AtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    decoded_block_cache = Param.Bool(False,
+        "Cache decoded basic blocks and replay them without fetching and "
+        "decoding. Instructions in a cached block are not fetched from the "
+        "icache and run in a single tick event (still charging a cycle "
+        "per width instructions). Blocks are invalidated by stores of "
+        "this CPU and by snooped writes.")
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
@@ -79,6 +79,10 @@ AtomicSimpleCPU::AtomicSimpleCPU(const AtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      decodedBlockCache(p.decoded_block_cache),
+      replayBlock(nullptr), replayIdx(0),
+      recordBlock(nullptr), recordPaddr(0),
+      decodedBlockStats(this),
       icachePort(name() + ".icache_port", this),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
@@ -92,6 +96,20 @@ AtomicSimpleCPU::AtomicSimpleCPU(const AtomicSimpleCPUParams &p)
 }
 
 
+AtomicSimpleCPU::DecodedBlockStats::DecodedBlockStats(
+        statistics::Group *parent)
+    : statistics::Group(parent, "decodedBlocks"),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Number of decoded blocks found in the cache"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of decoded blocks not found in the cache"),
+      ADD_STAT(replayedInsts, statistics::units::Count::get(),
+               "Number of instructions replayed from decoded blocks"),
+      ADD_STAT(invalidations, statistics::units::Count::get(),
+               "Number of decoded blocks invalidated by writes")
+{
+}
+
 AtomicSimpleCPU::~AtomicSimpleCPU()
 {
     if (tickEvent.scheduled()) {
@@ -149,6 +167,9 @@ AtomicSimpleCPU::drainResume()
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
 
+    // Memory may have changed while drained (e.g., checkpoint restore)
+    flushDecodedBlocks();
+
     assert(!threadContexts.empty());
 
     _status = BaseSimpleCPU::Idle;
@@ -207,6 +228,8 @@ AtomicSimpleCPU::takeOverFrom(BaseCPU *old_cpu)
 
     // The tick event should have been descheduled by drain()
     assert(!tickEvent.scheduled());
+
+    flushDecodedBlocks();
 }
 
 void
@@ -300,6 +323,7 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
         for (auto &t_info : cpu->threadInfo) {
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
+        cpu->invalidateDecodedBlocks(pkt->getAddr(), pkt->getSize());
     }
 
     return 0;
@@ -327,6 +351,9 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
     }
+
+    if (pkt->isInvalidate() || pkt->isWrite())
+        cpu->invalidateDecodedBlocks(pkt->getAddr(), pkt->getSize());
 }
 
 bool
@@ -506,6 +533,7 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
                     // Notify other threads on this CPU of write
                     threadSnoop(&pkt, curThread);
                 }
+                invalidateDecodedBlocks(req->getPaddr(), req->getSize());
                 dcache_access = true;
                 assert(!pkt.isError());
 
@@ -593,6 +621,7 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
         } else {
             dcache_latency += sendPacket(dcachePort, &pkt);
         }
+        invalidateDecodedBlocks(req->getPaddr(), req->getSize());
 
         dcache_access = true;
 
@@ -624,14 +653,23 @@ AtomicSimpleCPU::tick()
         data_read_req->setContext(cid);
         data_write_req->setContext(cid);
         data_amo_req->setContext(cid);
+
+        // Blocks only hold instructions of one thread
+        endRecordedBlock();
     }
 
     SimpleExecContext &t_info = *threadInfo[curThread];
     SimpleThread *thread = t_info.thread;
 
     Tick latency = 0;
+    int replay_cycles = 0;
+
+    // A replayed block runs to its end in this tick, charging a cycle for
+    // every width instructions it runs beyond the first cycle
+    for (int i = 0; i < width || locked || replayBlock; ++i) {
+        if (replayBlock && i >= width && i % width == 0)
+            replay_cycles++;
 
-    for (int i = 0; i < width || locked; ++i) {
         baseStats.numCycles++;
         updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
@@ -642,6 +680,8 @@ AtomicSimpleCPU::tick()
 
         // We must have just got suspended by a PC event
         if (_status == Idle) {
+            if (replayBlock)
+                stopReplay();
             tryCompleteDrain();
             return;
         }
@@ -654,11 +694,25 @@ AtomicSimpleCPU::tick()
 
         bool needToFetch = !isRomMicroPC(pcState.microPC()) &&
                            !curMacroStaticInst;
-        if (needToFetch) {
+        const DecodedBlock::Inst *replay_inst = nullptr;
+        if (needToFetch && replayBlock)
+            replay_inst = nextReplayInst(pcState);
+
+        if (needToFetch && !replay_inst) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
             fault = thread->mmu->translateAtomic(ifetch_req, thread->getTC(),
                                                  BaseMMU::Execute);
+
+            if (decodedBlockCache && fault == NoFault && !recordBlock &&
+                t_info.fetchOffset == 0) {
+                Addr paddr = ifetch_req->getPaddr() +
+                    (pcState.instAddr() - ifetch_req->getVaddr());
+                if (startReplay(pcState, paddr))
+                    replay_inst = nextReplayInst(pcState);
+                else
+                    startRecording(pcState, paddr);
+            }
         }
 
         if (fault == NoFault) {
@@ -666,7 +720,7 @@ AtomicSimpleCPU::tick()
             bool icache_access = false;
             dcache_access = false; // assume no dcache access
 
-            if (needToFetch) {
+            if (needToFetch && !replay_inst) {
                 // This is commented out because the decoder would act like
                 // a tiny cache otherwise. It wouldn't be flushed when needed
                 // like the I cache. It should be flushed, and when that works
@@ -679,7 +733,15 @@ AtomicSimpleCPU::tick()
                 //}
             }
 
-            preExecute();
+            if (replay_inst) {
+                thread->pcState(replay_inst->decodedPC);
+                preExecute(replay_inst->inst);
+                ++decodedBlockStats.replayedInsts;
+            } else {
+                preExecute();
+                if (recordBlock && needToFetch && !t_info.stayAtPC)
+                    recordInst(pcState);
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
@@ -702,6 +764,10 @@ AtomicSimpleCPU::tick()
                 }
 
                 postExecute();
+
+                // System calls may write memory behind the CPU's back
+                if (!FullSystem && curStaticInst->isSyscall())
+                    flushDecodedBlocks();
             }
 
             // @todo remove me after debugging with legion done
@@ -725,6 +791,12 @@ AtomicSimpleCPU::tick()
             }
 
         }
+
+        if (recordBlock &&
+            (fault != NoFault || endsDecodedBlock(curStaticInst))) {
+            endRecordedBlock();
+        }
+
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
     }
@@ -735,11 +807,157 @@ AtomicSimpleCPU::tick()
     // instruction takes at least one cycle
     if (latency < clockPeriod())
         latency = clockPeriod();
+    latency += replay_cycles * clockPeriod();
 
     if (_status != Idle)
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+bool
+AtomicSimpleCPU::startReplay(const TheISA::PCState &pc, Addr paddr)
+{
+    auto &decoder = threadInfo[curThread]->thread->decoder;
+
+    auto it = decodedBlocks.find(paddr);
+    if (it == decodedBlocks.end() || it->second.insts.empty() ||
+        it->second.vaddr != pc.instAddr() ||
+        it->second.decoderContext != decoder.context() ||
+        !(it->second.insts[0].fetchPC == pc)) {
+        ++decodedBlockStats.misses;
+        return false;
+    }
+
+    ++decodedBlockStats.hits;
+    replayBlock = &it->second;
+    replayIdx = 0;
+    return true;
+}
+
+const AtomicSimpleCPU::DecodedBlock::Inst *
+AtomicSimpleCPU::nextReplayInst(const TheISA::PCState &pc)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    auto &decoder = t_info.thread->decoder;
+    auto &insts = replayBlock->insts;
+
+    // Stop as soon as the thread left the block (e.g., a fault or an
+    // interrupt redirected it) or the decoder context changed
+    if (replayIdx >= insts.size() || t_info.fetchOffset != 0 ||
+        !(insts[replayIdx].fetchPC == pc) ||
+        replayBlock->decoderContext != decoder.context()) {
+        stopReplay();
+        return nullptr;
+    }
+
+    const DecodedBlock::Inst *inst = &insts[replayIdx++];
+    if (replayIdx == insts.size())
+        stopReplay();
+    return inst;
+}
+
+void
+AtomicSimpleCPU::stopReplay()
+{
+    replayBlock = nullptr;
+
+    // The decoder did not see the replayed instructions
+    threadInfo[curThread]->thread->decoder.reset();
+}
+
+void
+AtomicSimpleCPU::startRecording(const TheISA::PCState &pc, Addr paddr)
+{
+    if (decodedBlocks.size() >= MaxDecodedBlocks)
+        flushDecodedBlocks();
+
+    DecodedBlock &block = decodedBlocks[paddr];
+    block.vaddr = pc.instAddr();
+    block.decoderContext = threadInfo[curThread]->thread->decoder.context();
+    block.insts.clear();
+
+    recordBlock = &block;
+    recordPaddr = paddr;
+    decodedBlockRegions.insert(roundDown(paddr, DecodedBlockRegionBytes));
+}
+
+void
+AtomicSimpleCPU::recordInst(const TheISA::PCState &fetch_pc)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread *thread = t_info.thread;
+    auto &decoder = thread->decoder;
+
+    // All the bytes fetched for the instruction must be in the region of
+    // the block, so they share its translation and invalidations
+    Addr region = roundDown(recordBlock->vaddr, DecodedBlockRegionBytes);
+    Addr first_byte = fetch_pc.instAddr() & decoder.pcMask();
+    Addr last_byte = first_byte + t_info.fetchOffset +
+        decoder.moreBytesSize() - 1;
+    if (roundDown(first_byte, DecodedBlockRegionBytes) != region ||
+        roundDown(last_byte, DecodedBlockRegionBytes) != region ||
+        decoder.context() != recordBlock->decoderContext) {
+        endRecordedBlock();
+        return;
+    }
+
+    recordBlock->insts.push_back({fetch_pc, thread->pcState(),
+            curMacroStaticInst ? curMacroStaticInst : curStaticInst});
+
+    if (recordBlock->insts.size() >= MaxDecodedBlockInsts)
+        endRecordedBlock();
+}
+
+void
+AtomicSimpleCPU::endRecordedBlock()
+{
+    if (recordBlock && recordBlock->insts.empty())
+        decodedBlocks.erase(recordPaddr);
+    recordBlock = nullptr;
+}
+
+bool
+AtomicSimpleCPU::endsDecodedBlock(const StaticInstPtr &inst)
+{
+    return inst && (inst->isControl() || inst->isSerializing() ||
+                    inst->isNonSpeculative() || inst->isSquashAfter() ||
+                    inst->isSyscall());
+}
+
+void
+AtomicSimpleCPU::invalidateDecodedBlocks(Addr paddr, Addr size)
+{
+    if (decodedBlockRegions.empty())
+        return;
+
+    for (Addr region = roundDown(paddr, DecodedBlockRegionBytes);
+         region < paddr + size; region += DecodedBlockRegionBytes) {
+        if (!decodedBlockRegions.erase(region))
+            continue;
+
+        auto begin = decodedBlocks.lower_bound(region);
+        auto end = decodedBlocks.lower_bound(
+            region + DecodedBlockRegionBytes);
+        for (auto it = begin; it != end; ++it) {
+            if (&it->second == replayBlock)
+                stopReplay();
+            if (&it->second == recordBlock)
+                recordBlock = nullptr;
+            ++decodedBlockStats.invalidations;
+        }
+        decodedBlocks.erase(begin, end);
+    }
+}
+
+void
+AtomicSimpleCPU::flushDecodedBlocks()
+{
+    if (replayBlock)
+        stopReplay();
+    recordBlock = nullptr;
+    decodedBlocks.clear();
+    decodedBlockRegions.clear();
+}
+
 Tick
 AtomicSimpleCPU::fetchInstMem()
 {
@@ -41,6 +41,12 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <map>
+#include <unordered_set>
+#include <vector>
+
+#include "arch/pcstate.hh"
+#include "base/statistics.hh"
 #include "cpu/simple/base.hh"
 #include "cpu/simple/exec_context.hh"
 #include "mem/request.hh"
@@ -70,6 +76,89 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     // main simulation loop (one cycle)
     void tick();
 
+    /**
+     * A block of decoded instructions, recorded the first time the block
+     * is executed and replayed without fetching and decoding when the
+     * CPU reaches it again. A block starts after a control instruction
+     * and ends at the next instruction that may change the control flow
+     * or the decoder context. Every instruction remembers the exact PC
+     * state it was decoded at, replay stops as soon as the thread is
+     * somewhere else (e.g., after a fault or an interrupt).
+     */
+    struct DecodedBlock
+    {
+        struct Inst
+        {
+            /** PC state the instruction was fetched at. */
+            TheISA::PCState fetchPC;
+            /** PC state left by decoding the instruction. */
+            TheISA::PCState decodedPC;
+            /** The instruction, or its macroop. */
+            StaticInstPtr inst;
+        };
+
+        Addr vaddr;
+        uint64_t decoderContext;
+        std::vector<Inst> insts;
+    };
+
+    /** Blocks never span regions of this size, so they are physically
+     * contiguous and need a single translation. */
+    static const Addr DecodedBlockRegionBytes = 4096;
+    static const size_t MaxDecodedBlockInsts = 64;
+    static const size_t MaxDecodedBlocks = 1 << 16;
+
+    const bool decodedBlockCache;
+
+    /** Decoded blocks by the physical address of their first instruction. */
+    std::map<Addr, DecodedBlock> decodedBlocks;
+    /** Regions holding decoded blocks, whose stores invalidate them. */
+    std::unordered_set<Addr> decodedBlockRegions;
+
+    /** The block being replayed and the index of its next instruction. */
+    DecodedBlock *replayBlock;
+    size_t replayIdx;
+    /** The block being recorded and its physical address. */
+    DecodedBlock *recordBlock;
+    Addr recordPaddr;
+
+    struct DecodedBlockStats : public statistics::Group
+    {
+        DecodedBlockStats(statistics::Group *parent);
+
+        statistics::Scalar hits;
+        statistics::Scalar misses;
+        statistics::Scalar replayedInsts;
+        statistics::Scalar invalidations;
+    } decodedBlockStats;
+
+    /**
+     * Look up the block starting at the current PC, given the physical
+     * address of the instruction, and start replaying it on a hit.
+     */
+    bool startReplay(const TheISA::PCState &pc, Addr paddr);
+
+    /**
+     * The next instruction of the replayed block, if the thread is where
+     * the block expects it to be. Replay stops otherwise.
+     */
+    const DecodedBlock::Inst *nextReplayInst(const TheISA::PCState &pc);
+    void stopReplay();
+
+    /** Start recording a block at the current PC. */
+    void startRecording(const TheISA::PCState &pc, Addr paddr);
+
+    /** Append the instruction just decoded at fetch_pc to the block. */
+    void recordInst(const TheISA::PCState &fetch_pc);
+    void endRecordedBlock();
+
+    /** Whether a block ends after an instruction. */
+    static bool endsDecodedBlock(const StaticInstPtr &inst);
+
+    /** Drop the blocks holding instructions in [paddr, paddr + size). */
+    void invalidateDecodedBlocks(Addr paddr, Addr size);
+    void flushDecodedBlocks();
+
     /**
      * Check if a system is in a drained state.
      *
@@ -310,7 +310,7 @@ BaseSimpleCPU::serviceInstCountEvents()
 }
 
 void
-BaseSimpleCPU::preExecute()
+BaseSimpleCPU::preExecute(const StaticInstPtr &decoded_inst)
 {
     SimpleExecContext &t_info = *threadInfo[curThread];
     SimpleThread* thread = t_info.thread;
@@ -333,24 +333,28 @@ BaseSimpleCPU::preExecute()
                 pcState.microPC(), curMacroStaticInst);
     } else if (!curMacroStaticInst) {
         //We're not in the middle of a macro instruction
-        StaticInstPtr instPtr = NULL;
+        StaticInstPtr instPtr = decoded_inst;
 
-        //Predecode, ie bundle up an ExtMachInst
-        //If more fetch data is needed, pass it in.
-        Addr fetchPC =
-            (pcState.instAddr() & decoder.pcMask()) + t_info.fetchOffset;
-
-        decoder.moreBytes(pcState, fetchPC);
-
-        //Decode an instruction if one is ready. Otherwise, we'll have to
-        //fetch beyond the MachInst at the current pc.
-        instPtr = decoder.decode(pcState);
         if (instPtr) {
             t_info.stayAtPC = false;
-            thread->pcState(pcState);
         } else {
-            t_info.stayAtPC = true;
-            t_info.fetchOffset += decoder.moreBytesSize();
+            //Predecode, ie bundle up an ExtMachInst
+            //If more fetch data is needed, pass it in.
+            Addr fetchPC =
+                (pcState.instAddr() & decoder.pcMask()) + t_info.fetchOffset;
+
+            decoder.moreBytes(pcState, fetchPC);
+
+            //Decode an instruction if one is ready. Otherwise, we'll have
+            //to fetch beyond the MachInst at the current pc.
+            instPtr = decoder.decode(pcState);
+            if (instPtr) {
+                t_info.stayAtPC = false;
+                thread->pcState(pcState);
+            } else {
+                t_info.stayAtPC = true;
+                t_info.fetchOffset += decoder.moreBytesSize();
+            }
         }
 
         //If we decoded an instruction and it's microcoded, start pulling
@@ -463,7 +467,7 @@ BaseSimpleCPU::postExecute()
     }
 
     // Call CPU instruction commit probes
-    probeInstCommit(curStaticInst, instAddr);
+    probeInstCommit(curStaticInst, pc);
 }
 
 void
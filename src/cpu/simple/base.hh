@@ -134,7 +134,13 @@ class BaseSimpleCPU : public BaseCPU
     void checkForInterrupts();
     void setupFetchRequest(const RequestPtr &req);
     void serviceInstCountEvents();
-    void preExecute();
+    /**
+     * Prepare the next instruction for execution, decoding it unless
+     * the CPU model provides the instruction it previously decoded at
+     * the current PC (the thread must then have the PC state decoding
+     * left).
+     */
+    void preExecute(const StaticInstPtr &decoded_inst=nullStaticInstPtr);
     void postExecute();
     void advancePC(const Fault &fault);
 
@@ -38,12 +38,31 @@
 #include "cpu/simple/noncaching.hh"
 
 #include <cassert>
+#include <cstring>
+
+#include "sim/eventq.hh"
 
 namespace gem5
 {
 
+namespace
+{
+
+template <class T>
+void
+atomicCopy(uint8_t *dst, const uint8_t *src)
+{
+    T val = __atomic_load_n(reinterpret_cast<const T *>(src),
+                            __ATOMIC_RELAXED);
+    std::memcpy(dst, &val, sizeof(T));
+}
+
+} // anonymous namespace
+
+std::recursive_mutex NonCachingSimpleCPU::exclusiveLock;
+
 NonCachingSimpleCPU::NonCachingSimpleCPU(const NonCachingSimpleCPUParams &p)
-    : AtomicSimpleCPU(p)
+    : AtomicSimpleCPU(p), lockedRMWExclusive(false)
 {
     assert(p.numThreads == 1);
     fatal_if(!FullSystem && p.workload.size() != 1,
@@ -59,9 +78,116 @@ NonCachingSimpleCPU::verifyMemoryMode() const
     }
 }
 
+void
+NonCachingSimpleCPU::beginExclusive()
+{
+    if (!inParallelMode)
+        return;
+
+    if (!exclusiveLock.try_lock()) {
+        EventQueue::ScopedRelease release(curEventQueue());
+        exclusiveLock.lock();
+    }
+}
+
+void
+NonCachingSimpleCPU::endExclusive()
+{
+    if (inParallelMode)
+        exclusiveLock.unlock();
+}
+
+Fault
+NonCachingSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
+                             Request::Flags flags,
+                             const std::vector<bool> &byte_enable)
+{
+    // Only reads which take a reservation or a lock have to be ordered
+    // against the writes of the other CPUs.
+    if (!flags.isSet(Request::LLSC | Request::LOCKED_RMW))
+        return AtomicSimpleCPU::readMem(addr, data, size, flags, byte_enable);
+
+    beginExclusive();
+    Fault fault = AtomicSimpleCPU::readMem(addr, data, size, flags,
+                                           byte_enable);
+    // Keep the lock until the write completing the locked sequence.
+    if (locked && !lockedRMWExclusive)
+        lockedRMWExclusive = true;
+    else
+        endExclusive();
+    return fault;
+}
+
+Fault
+NonCachingSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
+                              Request::Flags flags, uint64_t *res,
+                              const std::vector<bool> &byte_enable)
+{
+    beginExclusive();
+    Fault fault = AtomicSimpleCPU::writeMem(data, size, addr, flags, res,
+                                            byte_enable);
+    if (lockedRMWExclusive && !locked) {
+        lockedRMWExclusive = false;
+        endExclusive();
+    }
+    endExclusive();
+    return fault;
+}
+
+Fault
+NonCachingSimpleCPU::amoMem(Addr addr, uint8_t *data, unsigned size,
+                            Request::Flags flags, AtomicOpFunctorPtr amo_op)
+{
+    beginExclusive();
+    Fault fault = AtomicSimpleCPU::amoMem(addr, data, size, flags,
+                                          std::move(amo_op));
+    endExclusive();
+    return fault;
+}
+
+void
+NonCachingSimpleCPU::readBackdoor(uint8_t *dst, const uint8_t *src,
+                                  unsigned size)
+{
+    // Other CPUs may write the same location from their own thread.
+    bool aligned = (reinterpret_cast<uintptr_t>(src) & (size - 1)) == 0;
+    switch (aligned ? size : 0) {
+      case 1:
+        atomicCopy<uint8_t>(dst, src);
+        break;
+      case 2:
+        atomicCopy<uint16_t>(dst, src);
+        break;
+      case 4:
+        atomicCopy<uint32_t>(dst, src);
+        break;
+      case 8:
+        atomicCopy<uint64_t>(dst, src);
+        break;
+      default:
+        std::memcpy(dst, src, size);
+    }
+}
+
 Tick
 NonCachingSimpleCPU::sendPacket(RequestPort &port, const PacketPtr &pkt)
 {
+    // Plain reads are served by the backdoors. Anything else may have to
+    // be observed by the memory system or by the other CPUs.
+    const RequestPtr &req = pkt->req;
+    if (pkt->cmd == MemCmd::ReadReq && !req->isUncacheable() &&
+        !req->isMasked()) {
+        auto bd_it = memBackdoors.contains(pkt->getAddrRange());
+        if (bd_it != memBackdoors.end() && bd_it->second->readable()) {
+            auto *bd = bd_it->second;
+            readBackdoor(pkt->getPtr<uint8_t>(),
+                         bd->ptr() + (pkt->getAddr() - bd->range().start()),
+                         pkt->getSize());
+            pkt->makeResponse();
+            return 0;
+        }
+    }
+
     MemBackdoorPtr bd = nullptr;
     Tick latency = port.sendAtomicBackdoor(pkt, bd);
 
@@ -95,7 +221,8 @@ NonCachingSimpleCPU::fetchInstMem()
 
     auto *bd = bd_it->second;
     Addr offset = ifetch_req->getPaddr() - bd->range().start();
-    memcpy(decoder.moreBytesPtr(), bd->ptr() + offset, ifetch_req->getSize());
+    readBackdoor(static_cast<uint8_t *>(decoder.moreBytesPtr()),
+                 bd->ptr() + offset, ifetch_req->getSize());
     return 0;
 }
 
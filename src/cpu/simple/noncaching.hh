@@ -38,6 +38,8 @@
 #ifndef __CPU_SIMPLE_NONCACHING_HH__
 #define __CPU_SIMPLE_NONCACHING_HH__
 
+#include <mutex>
+
 #include "base/addr_range_map.hh"
 #include "cpu/simple/atomic.hh"
 #include "mem/backdoor.hh"
@@ -49,6 +51,16 @@ namespace gem5
 /**
  * The NonCachingSimpleCPU is an AtomicSimpleCPU using the
  * 'atomic_noncaching' memory mode instead of just 'atomic'.
+ *
+ * Instruction fetches and plain data reads are served directly from the
+ * memory backdoors handed out by the memory system. Writes and guest
+ * atomics go through the ports, so that other CPUs snoop them.
+ *
+ * When the CPUs are simulated in parallel by several event queues, the
+ * writes and guest atomics of all NonCachingSimpleCPUs are serialized
+ * by a lock, held from the check of an LL/SC reservation to the store
+ * and across locked read-modify-write sequences. Backdoor reads use host
+ * atomic loads and never see a racing write torn.
  */
 class NonCachingSimpleCPU : public AtomicSimpleCPU
 {
@@ -57,9 +69,40 @@ class NonCachingSimpleCPU : public AtomicSimpleCPU
 
     void verifyMemoryMode() const override;
 
+    Fault readMem(Addr addr, uint8_t *data, unsigned size,
+                  Request::Flags flags,
+                  const std::vector<bool> &byte_enable=std::vector<bool>())
+        override;
+
+    Fault writeMem(uint8_t *data, unsigned size,
+                   Addr addr, Request::Flags flags, uint64_t *res,
+                   const std::vector<bool> &byte_enable=std::vector<bool>())
+        override;
+
+    Fault amoMem(Addr addr, uint8_t *data, unsigned size,
+                 Request::Flags flags, AtomicOpFunctorPtr amo_op) override;
+
   protected:
     AddrRangeMap<MemBackdoorPtr, 1> memBackdoors;
 
+    /** Serializes writes and guest atomics in parallel simulation. */
+    static std::recursive_mutex exclusiveLock;
+
+    /** Whether a locked RMW sequence holds exclusiveLock. */
+    bool lockedRMWExclusive;
+
+    /**
+     * Take and release exclusiveLock, if the simulation is parallel.
+     * The holder of the lock may have to migrate to the event queue of
+     * this CPU to snoop it, so never wait for the lock holding it.
+     */
+    void beginExclusive();
+    void endExclusive();
+
+    /** Copy from a backdoor, atomically for naturally aligned sizes. */
+    static void readBackdoor(uint8_t *dst, const uint8_t *src,
+                             unsigned size);
+
     Tick sendPacket(RequestPort &port, const PacketPtr &pkt) override;
     Tick fetchInstMem() override;
 };
@@ -31,6 +31,8 @@
 
 #include <cassert>
 #include <cstring>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace gem5
@@ -54,6 +56,19 @@ class TimeBuffer
         assert (idx >= -past && idx <= future);
     }
 
+    /**
+     * A payload may provide a reset() method which puts it back in its
+     * freshly constructed state. Payloads that know which of their
+     * fields were written can do that far more cheaply than destroying,
+     * clearing and constructing the whole slot on every advance().
+     */
+    template <class U, class = void>
+    struct HasReset : std::false_type {};
+
+    template <class U>
+    struct HasReset<U, std::void_t<decltype(std::declval<U &>().reset())>>
+        : std::true_type {};
+
   public:
     friend class wire;
     class wire
@@ -184,9 +199,13 @@ class TimeBuffer
         int ptr = base + future;
         if (ptr >= (int)size)
             ptr -= size;
-        (reinterpret_cast<T *>(index[ptr]))->~T();
-        std::memset(index[ptr], 0, sizeof(T));
-        new (index[ptr]) T;
+        if constexpr (HasReset<T>::value) {
+            (reinterpret_cast<T *>(index[ptr]))->reset();
+        } else {
+            (reinterpret_cast<T *>(index[ptr]))->~T();
+            std::memset(index[ptr], 0, sizeof(T));
+            new (index[ptr]) T;
+        }
     }
 
   protected:
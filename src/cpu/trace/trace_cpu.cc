@@ -37,6 +37,9 @@
 
 #include "cpu/trace/trace_cpu.hh"
 
+#include <algorithm>
+#include <functional>
+
 #include "base/compiler.hh"
 #include "sim/sim_exit.hh"
 
@@ -44,7 +47,7 @@ namespace gem5
 {
 
 // Declare and initialize the static counter for number of trace CPUs.
-int TraceCPU::numTraceCPUs = 0;
+std::atomic<int> TraceCPU::numTraceCPUs(0);
 
 TraceCPU::TraceCPU(const TraceCPUParams &params)
     :   BaseCPU(params),
@@ -61,7 +64,8 @@ TraceCPU::TraceCPU(const TraceCPUParams &params)
         dcacheNextEvent([this]{ schedDcacheNext(); }, name()),
         oneTraceComplete(false),
         traceOffset(0),
-        execCompleteEvent(nullptr),
+        execCompleteEvent([this]{ execComplete(); }, name(), false,
+                          Event::Sim_Exit_Pri),
         enableEarlyExit(params.enableEarlyExit),
         progressMsgInterval(params.progressMsgInterval),
         progressMsgThreshold(params.progressMsgInterval), traceStats(this)
@@ -131,17 +135,6 @@ TraceCPU::init()
     // send its first request at the first event and schedule subsequent
     // events using a relative tick delta
     dcacheGen.adjustInitTraceOffset(traceOffset);
-
-    // If the Trace CPU simulation is configured to exit on any one trace
-    // completion then we don't need a counted event to count down all Trace
-    // CPUs in the system. If not then instantiate a counted event.
-    if (!enableEarlyExit) {
-        // The static counter for number of Trace CPUs is correctly set at
-        // this point so create an event and pass it.
-        execCompleteEvent = new CountedExitEvent("end of all traces reached.",
-                                                 numTraceCPUs);
-    }
-
 }
 
 void
@@ -200,10 +193,17 @@ TraceCPU::checkAndSchedExitEvent()
         if (enableEarlyExit) {
             exitSimLoop("End of trace reached");
         } else {
-            schedule(*execCompleteEvent, curTick());
+            schedule(execCompleteEvent, curTick());
         }
     }
 }
+
+void
+TraceCPU::execComplete()
+{
+    if (--numTraceCPUs == 0)
+        exitSimLoop("end of all traces reached.", 0);
+}
  TraceCPU::TraceStats::TraceStats(TraceCPU *trace) :
     statistics::Group(trace),
     ADD_STAT(numSchedDcacheEvent, statistics::units::Count::get(),
@@ -270,21 +270,22 @@ TraceCPU::ElasticDataGen::init()
     if (debug::TraceCPUData) {
         printReadyList();
     }
-    auto free_itr = readyList.begin();
+    const ReadyNode &first_node = readyList.front();
     DPRINTF(TraceCPUData,
             "Execute tick of the first dependency free node %lli is %d.\n",
-            free_itr->seqNum, free_itr->execTick);
+            first_node.seqNum, first_node.execTick);
     // Return the execute tick of the earliest ready node so that an event
     // can be scheduled to call execute()
-    return (free_itr->execTick);
+    return first_node.execTick;
 }
 
 void
 TraceCPU::ElasticDataGen::adjustInitTraceOffset(Tick& offset)
 {
-    for (auto& free_node : readyList) {
+    // Shifting all the nodes keeps their order
+    readyList.forEach([offset](ReadyNode &free_node) {
         free_node.execTick -= offset;
-    }
+    });
 }
 
 void
@@ -401,16 +402,15 @@ TraceCPU::ElasticDataGen::execute()
         }
     }
     // Proceed to execute from readyList
-    auto graph_itr = depGraph.begin();
-    auto free_itr = readyList.begin();
     // Iterate through readyList until the next free node has its execute
     // tick later than curTick or the end of readyList is reached
-    while (free_itr->execTick <= curTick() && free_itr != readyList.end()) {
+    while (!readyList.empty() && readyList.front().execTick <= curTick()) {
 
-        // Get pointer to the node to be executed
-        graph_itr = depGraph.find(free_itr->seqNum);
-        assert(graph_itr != depGraph.end());
-        GraphNode* node_ptr = graph_itr->second;
+        // Get pointer to the node to be executed, and take it out of the
+        // heap while it wakes up its dependents
+        readyList.takeFront();
+        GraphNode* node_ptr = readyList.front().node;
+        assert(depGraph.count(node_ptr->seqNum));
 
         // If there is a retryPkt send that else execute the load
         if (retryPkt) {
@@ -494,7 +494,7 @@ TraceCPU::ElasticDataGen::execute()
         }
 
         // After executing the node, remove from readyList and delete node.
-        readyList.erase(free_itr);
+        readyList.pop();
         // If it is a cacheable load which was sent, don't delete
         // just yet.  Delete it in completeMemAccess() after the
         // response is received. If it is an strictly ordered
@@ -509,13 +509,11 @@ TraceCPU::ElasticDataGen::execute()
             (node_ptr->dependents).clear();
             // Update the stat for numOps simulated
             owner.updateNumOps(node_ptr->robNum);
+            // remove from graph
+            depGraph.erase(node_ptr->seqNum);
             // delete node
             delete node_ptr;
-            // remove from graph
-            depGraph.erase(graph_itr);
         }
-        // Point to first node to continue to next iteration of while loop
-        free_itr = readyList.begin();
     } // end of while loop
 
     // Print readyList, sizes of queues and resource status after updating
@@ -545,7 +543,7 @@ TraceCPU::ElasticDataGen::execute()
     // list is empty then check if the next pending node has resources
     // available to issue. If yes, then schedule an event for the next cycle.
     if (!readyList.empty()) {
-        Tick next_event_tick = std::max(readyList.begin()->execTick,
+        Tick next_event_tick = std::max(readyList.front().execTick,
                                         curTick());
         DPRINTF(TraceCPUData, "Attempting to schedule @%lli.\n",
                 next_event_tick);
@@ -644,7 +642,7 @@ TraceCPU::ElasticDataGen::executeMemReq(GraphNode* node_ptr)
 }
 
 bool
-TraceCPU::ElasticDataGen::checkAndIssue(const GraphNode* node_ptr, bool first)
+TraceCPU::ElasticDataGen::checkAndIssue(GraphNode* node_ptr, bool first)
 {
     // Assert the node is dependency-free
     assert(node_ptr->robDep.empty() && node_ptr->regDep.empty());
@@ -664,7 +662,7 @@ TraceCPU::ElasticDataGen::checkAndIssue(const GraphNode* node_ptr, bool first)
                 node_ptr->seqNum);
         // Compute the execute tick by adding the compute delay for the node
         // and add the ready node to the ready list
-        addToSortedReadyList(node_ptr->seqNum,
+        addToSortedReadyList(node_ptr,
                              owner.clockEdge() + node_ptr->compDelay);
         // Account for the resources taken up by this issued node.
         hwResource.occupy(node_ptr);
@@ -743,7 +741,7 @@ TraceCPU::ElasticDataGen::completeMemAccess(PacketPtr pkt)
         // are pending nodes in the depFreeQueue. The checking is done in the
         // execute() control flow, so schedule an event to go via that flow.
         Tick next_event_tick = readyList.empty() ? owner.clockEdge(Cycles(1)) :
-            std::max(readyList.begin()->execTick, owner.clockEdge(Cycles(1)));
+            std::max(readyList.front().execTick, owner.clockEdge(Cycles(1)));
         DPRINTF(TraceCPUData, "Attempting to schedule @%lli.\n",
                 next_event_tick);
         owner.schedDcacheNextEvent(next_event_tick);
@@ -751,60 +749,19 @@ TraceCPU::ElasticDataGen::completeMemAccess(PacketPtr pkt)
 }
 
 void
-TraceCPU::ElasticDataGen::addToSortedReadyList(NodeSeqNum seq_num,
+TraceCPU::ElasticDataGen::addToSortedReadyList(GraphNode *node_ptr,
                                                Tick exec_tick)
 {
     ReadyNode ready_node;
-    ready_node.seqNum = seq_num;
+    ready_node.seqNum = node_ptr->seqNum;
     ready_node.execTick = exec_tick;
+    ready_node.node = node_ptr;
 
-    // Iterator to readyList
-    auto itr = readyList.begin();
-
-    // If the readyList is empty, simply insert the new node at the beginning
-    // and return
-    if (itr == readyList.end()) {
-        readyList.insert(itr, ready_node);
-        elasticStats.maxReadyListSize =
-            std::max<double>(readyList.size(),
-                             elasticStats.maxReadyListSize.value());
-        return;
-    }
-
-    // If the new node has its execution tick equal to the first node in the
-    // list then go to the next node. If the first node in the list failed
-    // to execute, its position as the first is thus maintained.
-    if (retryPkt) {
-        if (retryPkt->req->getReqInstSeqNum() == itr->seqNum)
-            itr++;
-    }
+    // The nodes are kept in ascending order of their execution ticks, and
+    // then of their sequence numbers. If the first node in the list failed
+    // to execute, its position as the first is maintained.
+    readyList.push(ready_node);
 
-    // Increment the iterator and compare the node pointed to by it to the new
-    // node till the position to insert the new node is found.
-    bool found = false;
-    while (!found && itr != readyList.end()) {
-        // If the execution tick of the new node is less than the node then
-        // this is the position to insert
-        if (exec_tick < itr->execTick) {
-            found = true;
-        // If the execution tick of the new node is equal to the node then
-        // sort in ascending order of sequence numbers
-        } else if (exec_tick == itr->execTick) {
-            // If the sequence number of the new node is less than the node
-            // then this is the position to insert
-            if (seq_num < itr->seqNum) {
-                found = true;
-            // Else go to next node
-            } else {
-                itr++;
-            }
-        } else {
-            // If the execution tick of the new node is greater than the node
-            // then go to the next node.
-            itr++;
-        }
-    }
-    readyList.insert(itr, ready_node);
     // Update the stat for max size reached of the readyList
     elasticStats.maxReadyListSize = std::max<double>(readyList.size(),
                                         elasticStats.maxReadyListSize.value());
@@ -813,18 +770,57 @@ TraceCPU::ElasticDataGen::addToSortedReadyList(NodeSeqNum seq_num,
 void
 TraceCPU::ElasticDataGen::printReadyList()
 {
-    auto itr = readyList.begin();
-    if (itr == readyList.end()) {
+    if (readyList.empty()) {
         DPRINTF(TraceCPUData, "readyList is empty.\n");
         return;
     }
     DPRINTF(TraceCPUData, "Printing readyList:\n");
-    while (itr != readyList.end()) {
-        auto graph_itr = depGraph.find(itr->seqNum);
-        GEM5_VAR_USED GraphNode* node_ptr = graph_itr->second;
-        DPRINTFR(TraceCPUData, "\t%lld(%s), %lld\n", itr->seqNum,
-            node_ptr->typeToStr(), itr->execTick);
-        itr++;
+
+    // The node being executed comes first, then the heap in order
+    const ReadyNode &front = readyList.front();
+    std::vector<ReadyNode> nodes;
+    readyList.forEach([&front, &nodes](ReadyNode &ready_node) {
+        if (ready_node.seqNum != front.seqNum)
+            nodes.push_back(ready_node);
+    });
+    std::sort(nodes.begin(), nodes.end(),
+              [](const ReadyNode &a, const ReadyNode &b) { return b > a; });
+    nodes.insert(nodes.begin(), front);
+    for (const auto &ready_node : nodes) {
+        DPRINTFR(TraceCPUData, "\t%lld(%s), %lld\n", ready_node.seqNum,
+            ready_node.node->typeToStr(), ready_node.execTick);
+    }
+}
+
+void
+TraceCPU::ElasticDataGen::ReadyList::push(const ReadyNode &ready_node)
+{
+    heap.push_back(ready_node);
+    std::push_heap(heap.begin(), heap.end(), std::greater<ReadyNode>());
+}
+
+void
+TraceCPU::ElasticDataGen::ReadyList::takeFront()
+{
+    if (hasHead)
+        return;
+
+    assert(!heap.empty());
+    std::pop_heap(heap.begin(), heap.end(), std::greater<ReadyNode>());
+    head = heap.back();
+    heap.pop_back();
+    hasHead = true;
+}
+
+void
+TraceCPU::ElasticDataGen::ReadyList::pop()
+{
+    if (hasHead) {
+        hasHead = false;
+    } else {
+        assert(!heap.empty());
+        std::pop_heap(heap.begin(), heap.end(), std::greater<ReadyNode>());
+        heap.pop_back();
     }
 }
 
@@ -1197,6 +1193,7 @@ TraceCPU::DcachePort::recvReqRetry()
 TraceCPU::ElasticDataGen::InputStream::InputStream(
         const std::string& filename, const double time_multiplier) :
     trace(filename),
+    prefetch(trace),
     timeMultiplier(time_multiplier),
     microOpCount(0)
 {
@@ -1219,14 +1216,14 @@ TraceCPU::ElasticDataGen::InputStream::InputStream(
 void
 TraceCPU::ElasticDataGen::InputStream::reset()
 {
-    trace.reset();
+    prefetch.reset();
 }
 
 bool
 TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
 {
     ProtoMessage::InstDepRecord pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (prefetch.read(pkt_msg)) {
         // Required fields
         element->seqNum = pkt_msg.seq_num();
         element->type = pkt_msg.type();
@@ -1379,7 +1376,7 @@ TraceCPU::ElasticDataGen::GraphNode::typeToStr() const
 }
 
 TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
-    : trace(filename)
+    : trace(filename), prefetch(trace)
 {
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::PacketHeader header_msg;
@@ -1396,14 +1393,14 @@ TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
 void
 TraceCPU::FixedRetryGen::InputStream::reset()
 {
-    trace.reset();
+    prefetch.reset();
 }
 
 bool
 TraceCPU::FixedRetryGen::InputStream::read(TraceElement* element)
 {
     ProtoMessage::Packet pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (prefetch.read(pkt_msg)) {
         element->cmd = pkt_msg.cmd();
         element->addr = pkt_msg.addr();
         element->blocksize = pkt_msg.size();
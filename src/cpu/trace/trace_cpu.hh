@@ -38,11 +38,12 @@
 #ifndef __CPU_TRACE_TRACE_CPU_HH__
 #define __CPU_TRACE_TRACE_CPU_HH__
 
+#include <atomic>
 #include <cstdint>
-#include <list>
 #include <queue>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "cpu/base.hh"
@@ -72,7 +73,7 @@ namespace gem5
  * timing from the trace and without performing real execution of micro-ops. As
  * soon as the last dependency for an instruction is complete, its
  * computational delay, also provided in the input trace is added. The
- * dependency-free nodes are maintained in a list, called 'ReadyList', ordered
+ * dependency-free nodes are maintained in a heap, called 'ReadyList', ordered
  * by ready time. Instructions which depend on load stall until the responses
  * for read requests are received thus achieving elastic replay. If the
  * dependency is not found when adding a new node, it is assumed complete.
@@ -377,6 +378,9 @@ class TraceCPU : public BaseCPU
             // Input file stream for the protobuf trace
             ProtoInputStream trace;
 
+            // Messages of the trace, parsed ahead by a background thread
+            ProtoPrefetchStream<ProtoMessage::Packet> prefetch;
+
           public:
             /**
              * Create a trace input stream for a given file name.
@@ -557,11 +561,15 @@ class TraceCPU : public BaseCPU
         class GraphNode
         {
           public:
-            /** Typedef for the list containing the ROB dependencies */
-            typedef std::list<NodeSeqNum> RobDepList;
+            /**
+             * Typedef for the list containing the ROB dependencies. Nodes
+             * only have a few, which are cheaper to scan in an array than
+             * in a linked list.
+             */
+            typedef std::vector<NodeSeqNum> RobDepList;
 
             /** Typedef for the list containing the register dependencies */
-            typedef std::list<NodeSeqNum> RegDepList;
+            typedef std::vector<NodeSeqNum> RegDepList;
 
             /** Instruction sequence number */
             NodeSeqNum seqNum;
@@ -651,6 +659,68 @@ class TraceCPU : public BaseCPU
 
             /** The tick at which the ready node must be executed */
             Tick execTick;
+
+            /** The ready node, which stays in the depGraph while ready */
+            GraphNode *node;
+
+            /** Order of execution, by execute tick then sequence number */
+            bool
+            operator>(const ReadyNode &other) const
+            {
+                return execTick > other.execTick ||
+                    (execTick == other.execTick && seqNum > other.seqNum);
+            }
+        };
+
+        /**
+         * The ready nodes, in a binary heap ordered by execute tick. The
+         * node being executed is taken out of the heap, so that the nodes
+         * it wakes up do not take its place. If it fails to send its
+         * request, it stays at the head of the list until its retry.
+         */
+        class ReadyList
+        {
+          public:
+            bool empty() const { return !hasHead && heap.empty(); }
+
+            size_t size() const { return heap.size() + hasHead; }
+
+            /** Return the node to execute next. */
+            const ReadyNode &
+            front() const
+            {
+                assert(!empty());
+                return hasHead ? head : heap.front();
+            }
+
+            /** Add a ready node. */
+            void push(const ReadyNode &ready_node);
+
+            /**
+             * Take the node to execute next out of the heap, it remains
+             * the front of the list until it is popped.
+             */
+            void takeFront();
+
+            /** Remove the node to execute next. */
+            void pop();
+
+            /** Apply a function to all the nodes, in no particular order.
+             * The function must not change the order of the nodes. */
+            template <typename F>
+            void
+            forEach(F f)
+            {
+                if (hasHead)
+                    f(head);
+                for (auto &ready_node : heap)
+                    f(ready_node);
+            }
+
+          private:
+            std::vector<ReadyNode> heap;
+            ReadyNode head;
+            bool hasHead = false;
         };
 
         /**
@@ -764,6 +834,9 @@ class TraceCPU : public BaseCPU
             /** Input file stream for the protobuf trace */
             ProtoInputStream trace;
 
+            /** Messages of the trace, parsed ahead by a background thread */
+            ProtoPrefetchStream<ProtoMessage::InstDepRecord> prefetch;
+
             /**
              * A multiplier for the compute delays in the trace to modulate
              * the Trace CPU frequency either up or down. The Trace CPU's
@@ -836,6 +909,8 @@ class TraceCPU : public BaseCPU
         {
             DPRINTF(TraceCPUData, "Window size in the trace is %d.\n",
                     windowSize);
+            // The graph holds up to two windows of nodes
+            depGraph.reserve(2 * windowSize);
         }
 
         /**
@@ -907,10 +982,10 @@ class TraceCPU : public BaseCPU
          * Add a ready node to the readyList. When inserting, ensure the nodes
          * are sorted in ascending order of their execute ticks.
          *
-         * @param seq_num seq. num of ready node
+         * @param node_ptr the ready node
          * @param exec_tick the execute tick of the ready node
          */
-        void addToSortedReadyList(NodeSeqNum seq_num, Tick exec_tick);
+        void addToSortedReadyList(GraphNode *node_ptr, Tick exec_tick);
 
         /** Print readyList for debugging using debug flag TraceCPUData. */
         void printReadyList();
@@ -940,7 +1015,7 @@ class TraceCPU : public BaseCPU
          * @param first true if this is the first attempt to issue this node
          * @return true if node was added to readyList
          */
-        bool checkAndIssue(const GraphNode* node_ptr, bool first=true);
+        bool checkAndIssue(GraphNode* node_ptr, bool first=true);
 
         /** Get number of micro-ops modelled in the TraceCPU replay */
         uint64_t getMicroOpCount() const { return trace.getMicroOpCount(); }
@@ -1000,10 +1075,10 @@ class TraceCPU : public BaseCPU
          * into the queue in that order. Thus nodes are more likely to
          * issue in program order.
          */
-        std::queue<const GraphNode*> depFreeQueue;
+        std::queue<GraphNode*> depFreeQueue;
 
         /** List of nodes that are ready to execute */
-        std::list<ReadyNode> readyList;
+        ReadyList readyList;
 
       protected:
         // Defining the a stat group
@@ -1072,19 +1147,22 @@ class TraceCPU : public BaseCPU
     Tick traceOffset;
 
     /**
-     * Number of Trace CPUs in the system used as a shared variable and passed
-     * to the CountedExitEvent event used for counting down exit events.  It is
-     * incremented in the constructor call so that the total is arrived at
-     * automatically.
+     * Number of Trace CPUs in the system used as a shared variable for
+     * counting down exit events. It is incremented in the constructor call
+     * so that the total is arrived at automatically. It is atomic as Trace
+     * CPUs may replay their traces in parallel, on different event queues.
      */
-    static int numTraceCPUs;
+    static std::atomic<int> numTraceCPUs;
+
+    /** Decrement the counter and exit when it reaches zero. */
+    void execComplete();
 
    /**
-    * A CountedExitEvent which when serviced decrements the counter. A sim
-    * exit event is scheduled when the counter equals zero, that is all
-    * instances of Trace CPU have had their execCompleteEvent serviced.
+    * An event which when serviced decrements the counter. A sim exit event
+    * is scheduled when the counter equals zero, that is all instances of
+    * Trace CPU have had their execCompleteEvent serviced.
     */
-    CountedExitEvent *execCompleteEvent;
+    EventFunctionWrapper execCompleteEvent;
 
     /**
      * Exit when any one Trace CPU completes its execution. If this is
@@ -2419,6 +2419,8 @@ BaseCache::regProbePoints()
 bool
 BaseCache::CpuSidePort::recvTimingSnoopResp(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
+
     // Snoops shouldn't happen when bypassing caches
     assert(!cache->system->bypassCaches());
 
@@ -2433,6 +2435,8 @@ BaseCache::CpuSidePort::recvTimingSnoopResp(PacketPtr pkt)
 bool
 BaseCache::CpuSidePort::tryTiming(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
+
     if (cache->system->bypassCaches() || pkt->isExpressSnoop()) {
         // always let express snoop packets through even if blocked
         return true;
@@ -2449,6 +2453,7 @@ bool
 BaseCache::CpuSidePort::recvTimingReq(PacketPtr pkt)
 {
     assert(pkt->isRequest());
+    cache->checkQueue(*this);
 
     if (cache->system->bypassCaches()) {
         // Just forward the packet if caches are disabled.
@@ -2466,6 +2471,8 @@ BaseCache::CpuSidePort::recvTimingReq(PacketPtr pkt)
 Tick
 BaseCache::CpuSidePort::recvAtomic(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
+
     if (cache->system->bypassCaches()) {
         // Forward the request if the system is in cache bypass mode.
         return cache->memSidePort.sendAtomic(pkt);
@@ -2477,6 +2484,8 @@ BaseCache::CpuSidePort::recvAtomic(PacketPtr pkt)
 void
 BaseCache::CpuSidePort::recvFunctional(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
+
     if (cache->system->bypassCaches()) {
         // The cache should be flushed if we are in cache bypass mode,
         // so we don't need to check if we need to update anything.
@@ -2488,6 +2497,13 @@ BaseCache::CpuSidePort::recvFunctional(PacketPtr pkt)
     cache->functionalAccess(pkt, true);
 }
 
+void
+BaseCache::CpuSidePort::recvRespRetry()
+{
+    cache->checkQueue(*this);
+    CacheResponsePort::recvRespRetry();
+}
+
 AddrRangeList
 BaseCache::CpuSidePort::getAddrRanges() const
 {
@@ -2510,6 +2526,7 @@ CpuSidePort::CpuSidePort(const std::string &_name, BaseCache *_cache,
 bool
 BaseCache::MemSidePort::recvTimingResp(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
     cache->recvTimingResp(pkt);
     return true;
 }
@@ -2518,6 +2535,8 @@ BaseCache::MemSidePort::recvTimingResp(PacketPtr pkt)
 void
 BaseCache::MemSidePort::recvTimingSnoopReq(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
+
     // Snoops shouldn't happen when bypassing caches
     assert(!cache->system->bypassCaches());
 
@@ -2528,6 +2547,8 @@ BaseCache::MemSidePort::recvTimingSnoopReq(PacketPtr pkt)
 Tick
 BaseCache::MemSidePort::recvAtomicSnoop(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
+
     // Snoops shouldn't happen when bypassing caches
     assert(!cache->system->bypassCaches());
 
@@ -2537,6 +2558,8 @@ BaseCache::MemSidePort::recvAtomicSnoop(PacketPtr pkt)
 void
 BaseCache::MemSidePort::recvFunctionalSnoop(PacketPtr pkt)
 {
+    cache->checkQueue(*this);
+
     // Snoops shouldn't happen when bypassing caches
     assert(!cache->system->bypassCaches());
 
@@ -2546,6 +2569,20 @@ BaseCache::MemSidePort::recvFunctionalSnoop(PacketPtr pkt)
     cache->functionalAccess(pkt, false);
 }
 
+void
+BaseCache::MemSidePort::recvReqRetry()
+{
+    cache->checkQueue(*this);
+    CacheRequestPort::recvReqRetry();
+}
+
+void
+BaseCache::MemSidePort::recvRetrySnoopResp()
+{
+    cache->checkQueue(*this);
+    CacheRequestPort::recvRetrySnoopResp();
+}
+
 void
 BaseCache::CacheReqPacketQueue::sendDeferredPacket()
 {
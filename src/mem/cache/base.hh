@@ -257,6 +257,10 @@ class BaseCache : public ClockedObject
 
         virtual void recvFunctionalSnoop(PacketPtr pkt);
 
+        void recvReqRetry() override;
+
+        void recvRetrySnoopResp() override;
+
       public:
 
         MemSidePort(const std::string &_name, BaseCache *_cache,
@@ -326,6 +330,8 @@ class BaseCache : public ClockedObject
 
         virtual void recvFunctional(PacketPtr pkt) override;
 
+        void recvRespRetry() override;
+
         virtual AddrRangeList getAddrRanges() const override;
 
       public:
@@ -338,6 +344,18 @@ class BaseCache : public ClockedObject
     CpuSidePort cpuSidePort;
     MemSidePort memSidePort;
 
+    /**
+     * The cache is not thread-safe, a requestor simulated by another
+     * event queue must reach it through a CrossQueueBridge. Every port
+     * entry point checks that it is called from the cache's queue.
+     */
+    void
+    checkQueue(const Port &port) const
+    {
+        panic_if(!onOwnQueue(), "%s called from another event queue, use "
+                 "a CrossQueueBridge\n", port.name());
+    }
+
   protected:
 
     /** Miss status registers */
@@ -150,6 +150,7 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
 {
     // determine the source port based on the id
     ResponsePort *src_port = cpuSidePorts[cpu_side_port_id];
+    checkQueue(*src_port);
 
     // remember if the packet is an express snoop
     bool is_express_snoop = pkt->isExpressSnoop();
@@ -448,6 +449,7 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
 {
     // determine the source port based on the id
     RequestPort *src_port = memSidePorts[mem_side_port_id];
+    checkQueue(*src_port);
 
     // determine the destination
     const auto route_lookup = routeTo.find(pkt->req);
@@ -509,6 +511,7 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
 void
 CoherentXBar::recvTimingSnoopReq(PacketPtr pkt, PortID mem_side_port_id)
 {
+    checkQueue(*memSidePorts[mem_side_port_id]);
     DPRINTF(CoherentXBar, "%s: src %s packet %s\n", __func__,
             memSidePorts[mem_side_port_id]->name(), pkt->print());
 
@@ -571,6 +574,7 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
 {
     // determine the source port based on the id
     ResponsePort* src_port = cpuSidePorts[cpu_side_port_id];
+    checkQueue(*src_port);
 
     // get the destination
     const auto route_lookup = routeTo.find(pkt->req);
@@ -727,6 +731,8 @@ CoherentXBar::forwardTiming(PacketPtr pkt, PortID exclude_cpu_side_port_id,
 void
 CoherentXBar::recvReqRetry(PortID mem_side_port_id)
 {
+    checkQueue(*memSidePorts[mem_side_port_id]);
+
     // responses and snoop responses never block on forwarding them,
     // so the retry will always be coming from a port to which we
     // tried to forward a request
@@ -737,6 +743,7 @@ Tick
 CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
                                  MemBackdoorPtr *backdoor)
 {
+    checkQueue(*cpuSidePorts[cpu_side_port_id]);
     DPRINTF(CoherentXBar, "%s: src %s packet %s\n", __func__,
             cpuSidePorts[cpu_side_port_id]->name(), pkt->print());
 
@@ -888,6 +895,7 @@ CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
 Tick
 CoherentXBar::recvAtomicSnoop(PacketPtr pkt, PortID mem_side_port_id)
 {
+    checkQueue(*memSidePorts[mem_side_port_id]);
     DPRINTF(CoherentXBar, "%s: src %s packet %s\n", __func__,
             memSidePorts[mem_side_port_id]->name(), pkt->print());
 
@@ -1000,6 +1008,7 @@ CoherentXBar::forwardAtomic(PacketPtr pkt, PortID exclude_cpu_side_port_id,
 void
 CoherentXBar::recvFunctional(PacketPtr pkt, PortID cpu_side_port_id)
 {
+    checkQueue(*cpuSidePorts[cpu_side_port_id]);
     if (!pkt->isPrint()) {
         // don't do DPRINTFs on PrintReq as it clutters up the output
         DPRINTF(CoherentXBar, "%s: src %s packet %s\n", __func__,
@@ -1036,6 +1045,7 @@ CoherentXBar::recvFunctional(PacketPtr pkt, PortID cpu_side_port_id)
 void
 CoherentXBar::recvFunctionalSnoop(PacketPtr pkt, PortID mem_side_port_id)
 {
+    checkQueue(*memSidePorts[mem_side_port_id]);
     if (!pkt->isPrint()) {
         // don't do DPRINTFs on PrintReq as it clutters up the output
         DPRINTF(CoherentXBar, "%s: src %s packet %s\n", __func__,
@@ -136,6 +136,13 @@ class CoherentXBar : public BaseXBar
             xbar.recvFunctional(pkt, id);
         }
 
+        void
+        recvRespRetry() override
+        {
+            xbar.checkQueue(*this);
+            QueuedResponsePort::recvRespRetry();
+        }
+
         AddrRangeList
         getAddrRanges() const override
         {
@@ -298,6 +305,19 @@ class CoherentXBar : public BaseXBar
      */
     std::unique_ptr<Packet> pendingDelete;
 
+    /**
+     * The crossbar and its snoop filter are not thread-safe, a
+     * requestor simulated by another event queue must reach them
+     * through a CrossQueueBridge. Every entry point checks that it is
+     * called from the crossbar's queue.
+     */
+    void
+    checkQueue(const Port &port) const
+    {
+        panic_if(!onOwnQueue(), "%s called from another event queue, use "
+                 "a CrossQueueBridge\n", port.name());
+    }
+
     bool recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id);
     bool recvTimingResp(PacketPtr pkt, PortID mem_side_port_id);
     void recvTimingSnoopReq(PacketPtr pkt, PortID mem_side_port_id);
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definition of a bridge that connects a requestor and a responder
+ * simulated by different event queues.
+ */
+
+#include "mem/cross_queue_bridge.hh"
+
+#include <algorithm>
+#include <vector>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/CrossQueueBridge.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/**
+ * Queues the thread ran on before its current crossings, which it still
+ * holds. The current one is curEventQueue().
+ */
+thread_local std::vector<EventQueue *> heldQueues;
+
+} // anonymous namespace
+
+CrossQueueBridge::Crossing::Crossing(EventQueue *_queue, bool wait)
+    : prev(curEventQueue()), queue(_queue), locked(false), success(true)
+{
+    if (queue == prev)
+        return;
+
+    if (inParallelMode &&
+        std::find(heldQueues.begin(), heldQueues.end(), queue) ==
+        heldQueues.end()) {
+        if (wait)
+            queue->lock();
+        else
+            success = queue->try_lock();
+        locked = success;
+    }
+
+    if (success) {
+        heldQueues.push_back(prev);
+        curEventQueue(queue);
+    }
+}
+
+CrossQueueBridge::Crossing::~Crossing()
+{
+    if (queue == prev || !success)
+        return;
+
+    curEventQueue(prev);
+    heldQueues.pop_back();
+    if (locked)
+        queue->unlock();
+}
+
+CrossQueueBridge::CrossQueueBridge(const CrossQueueBridgeParams &p)
+    : ClockedObject(p),
+      cpuSidePort(name() + ".cpu_side_port", *this),
+      memSidePort(name() + ".mem_side_port", *this),
+      cpuSideQueue(getEventQueue(p.cpu_side_eventq_index)),
+      memSideWaits(p.eventq_index > p.cpu_side_eventq_index),
+      cpuSideWaits(p.cpu_side_eventq_index > p.eventq_index),
+      delay(p.delay),
+      retryReqEvent([this]{ sendRetryReq(); }, name() + ".retryReq"),
+      retrySnoopRespEvent([this]{ sendRetrySnoopResp(); },
+                          name() + ".retrySnoopResp"),
+      retryRespEvent([this]{ sendRetryResp(); }, name() + ".retryResp"),
+      stats(*this)
+{
+}
+
+void
+CrossQueueBridge::init()
+{
+    if (!cpuSidePort.isConnected() || !memSidePort.isConnected())
+        fatal("Cross-queue bridge %s is not connected on both sides.\n",
+              name());
+
+    fatal_if(cpuSidePort.isSnooping() && memSideWaits,
+             "%s: the requestor snoops, its event queue must have a higher "
+             "index than the memory side\n", name());
+
+    cpuSidePort.sendRangeChange();
+}
+
+Port &
+CrossQueueBridge::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side_port")
+        return memSidePort;
+    else if (if_name == "cpu_side_port")
+        return cpuSidePort;
+    else
+        return ClockedObject::getPort(if_name, idx);
+}
+
+void
+CrossQueueBridge::retryLater(Event &event)
+{
+    if (!event.scheduled())
+        curEventQueue()->schedule(&event, curTick() + clockPeriod());
+}
+
+void
+CrossQueueBridge::sendRetryReq()
+{
+    Crossing crossing(cpuSideQueue, cpuSideWaits);
+    if (!crossing.entered()) {
+        retryLater(retryReqEvent);
+        return;
+    }
+    cpuSidePort.sendRetryReq();
+}
+
+void
+CrossQueueBridge::sendRetrySnoopResp()
+{
+    Crossing crossing(cpuSideQueue, cpuSideWaits);
+    if (!crossing.entered()) {
+        retryLater(retrySnoopRespEvent);
+        return;
+    }
+    cpuSidePort.sendRetrySnoopResp();
+}
+
+void
+CrossQueueBridge::sendRetryResp()
+{
+    Crossing crossing(eventQueue(), memSideWaits);
+    if (!crossing.entered()) {
+        retryLater(retryRespEvent);
+        return;
+    }
+    memSidePort.sendRetryResp();
+}
+
+CrossQueueBridge::CPUSidePort::CPUSidePort(const std::string &_name,
+                                           CrossQueueBridge &_bridge)
+    : ResponsePort(_name, &_bridge), bridge(_bridge)
+{
+}
+
+bool
+CrossQueueBridge::CPUSidePort::recvTimingReq(PacketPtr pkt)
+{
+    Crossing crossing(bridge.eventQueue(), bridge.memSideWaits);
+    if (!crossing.entered()) {
+        DPRINTF(CrossQueueBridge, "Memory side busy, refusing %s\n",
+                pkt->print());
+        ++bridge.stats.reqsRefused;
+        bridge.retryLater(bridge.retryReqEvent);
+        return false;
+    }
+
+    DPRINTF(CrossQueueBridge, "Forwarding request %s\n", pkt->print());
+    pkt->headerDelay += bridge.delay;
+    if (!bridge.memSidePort.sendTimingReq(pkt)) {
+        // the responder will send a retry, which we forward
+        pkt->headerDelay -= bridge.delay;
+        return false;
+    }
+    ++bridge.stats.reqs;
+    return true;
+}
+
+bool
+CrossQueueBridge::CPUSidePort::recvTimingSnoopResp(PacketPtr pkt)
+{
+    Crossing crossing(bridge.eventQueue(), bridge.memSideWaits);
+    if (!crossing.entered()) {
+        DPRINTF(CrossQueueBridge, "Memory side busy, refusing %s\n",
+                pkt->print());
+        bridge.retryLater(bridge.retrySnoopRespEvent);
+        return false;
+    }
+
+    DPRINTF(CrossQueueBridge, "Forwarding snoop response %s\n",
+            pkt->print());
+    if (!bridge.memSidePort.sendTimingSnoopResp(pkt))
+        return false;
+    ++bridge.stats.snoopResps;
+    return true;
+}
+
+void
+CrossQueueBridge::CPUSidePort::recvRespRetry()
+{
+    bridge.sendRetryResp();
+}
+
+Tick
+CrossQueueBridge::CPUSidePort::recvAtomic(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(bridge.eventQueue());
+    return bridge.delay + bridge.memSidePort.sendAtomic(pkt);
+}
+
+Tick
+CrossQueueBridge::CPUSidePort::recvAtomicBackdoor(PacketPtr pkt,
+                                                  MemBackdoorPtr &backdoor)
+{
+    EventQueue::ScopedMigration migrate(bridge.eventQueue());
+    return bridge.delay +
+        bridge.memSidePort.sendAtomicBackdoor(pkt, backdoor);
+}
+
+void
+CrossQueueBridge::CPUSidePort::recvFunctional(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(bridge.eventQueue());
+    bridge.memSidePort.sendFunctional(pkt);
+}
+
+AddrRangeList
+CrossQueueBridge::CPUSidePort::getAddrRanges() const
+{
+    return bridge.memSidePort.getAddrRanges();
+}
+
+CrossQueueBridge::MemSidePort::MemSidePort(const std::string &_name,
+                                           CrossQueueBridge &_bridge)
+    : RequestPort(_name, &_bridge), bridge(_bridge)
+{
+}
+
+bool
+CrossQueueBridge::MemSidePort::recvTimingResp(PacketPtr pkt)
+{
+    Crossing crossing(bridge.cpuSideQueue, bridge.cpuSideWaits);
+    if (!crossing.entered()) {
+        DPRINTF(CrossQueueBridge, "CPU side busy, refusing %s\n",
+                pkt->print());
+        bridge.retryLater(bridge.retryRespEvent);
+        return false;
+    }
+
+    DPRINTF(CrossQueueBridge, "Forwarding response %s\n", pkt->print());
+    pkt->headerDelay += bridge.delay;
+    if (!bridge.cpuSidePort.sendTimingResp(pkt)) {
+        pkt->headerDelay -= bridge.delay;
+        return false;
+    }
+    ++bridge.stats.resps;
+    return true;
+}
+
+void
+CrossQueueBridge::MemSidePort::recvTimingSnoopReq(PacketPtr pkt)
+{
+    // Snoops cannot be refused, init() checked that they cross towards
+    // the higher queue.
+    Crossing crossing(bridge.cpuSideQueue, true);
+    ++bridge.stats.snoops;
+
+    DPRINTF(CrossQueueBridge, "Forwarding snoop %s\n", pkt->print());
+    bridge.cpuSidePort.sendTimingSnoopReq(pkt);
+}
+
+void
+CrossQueueBridge::MemSidePort::recvReqRetry()
+{
+    bridge.sendRetryReq();
+}
+
+void
+CrossQueueBridge::MemSidePort::recvRetrySnoopResp()
+{
+    bridge.sendRetrySnoopResp();
+}
+
+Tick
+CrossQueueBridge::MemSidePort::recvAtomicSnoop(PacketPtr pkt)
+{
+    Crossing crossing(bridge.cpuSideQueue, true);
+    return bridge.delay + bridge.cpuSidePort.sendAtomicSnoop(pkt);
+}
+
+void
+CrossQueueBridge::MemSidePort::recvFunctionalSnoop(PacketPtr pkt)
+{
+    Crossing crossing(bridge.cpuSideQueue, true);
+    bridge.cpuSidePort.sendFunctionalSnoop(pkt);
+}
+
+void
+CrossQueueBridge::MemSidePort::recvRangeChange()
+{
+    bridge.cpuSidePort.sendRangeChange();
+}
+
+bool
+CrossQueueBridge::MemSidePort::isSnooping() const
+{
+    return bridge.cpuSidePort.isSnooping();
+}
+
+CrossQueueBridge::CrossQueueBridgeStats::CrossQueueBridgeStats(
+        CrossQueueBridge &bridge)
+    : statistics::Group(&bridge),
+      ADD_STAT(reqs, statistics::units::Count::get(),
+               "Number of requests crossing the bridge"),
+      ADD_STAT(reqsRefused, statistics::units::Count::get(),
+               "Number of requests refused as the memory side was busy"),
+      ADD_STAT(resps, statistics::units::Count::get(),
+               "Number of responses crossing the bridge"),
+      ADD_STAT(snoops, statistics::units::Count::get(),
+               "Number of snoops crossing the bridge"),
+      ADD_STAT(snoopResps, statistics::units::Count::get(),
+               "Number of snoop responses crossing the bridge")
+{
+}
+
+} // namespace gem5
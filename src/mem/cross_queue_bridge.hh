@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a bridge that connects a requestor and a responder
+ * simulated by different event queues.
+ */
+
+#ifndef __MEM_CROSS_QUEUE_BRIDGE_HH__
+#define __MEM_CROSS_QUEUE_BRIDGE_HH__
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/port.hh"
+#include "params/CrossQueueBridge.hh"
+#include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * A cross-queue bridge lets a requestor, e.g., the private caches of a
+ * CPU, be simulated by another event queue, and thus host thread, than
+ * the memory system it is connected to. The crossbars and caches of the
+ * memory system are not thread-safe, so they must only be accessed from
+ * their own event queue.
+ *
+ * The CPU side port of the bridge belongs to the event queue of the
+ * requestor, and the memory side port to the event queue of the bridge.
+ * A packet crosses the bridge synchronously: the sender locks the queue
+ * of the other side, and runs on it until the packet has been handed
+ * over. The packet thus sees the current tick of the other queue, which
+ * may be up to a simulation quantum apart from its own.
+ *
+ * To avoid deadlocks, only crossings towards the queue with the higher
+ * index wait for it. Crossings towards the lower one only try to lock
+ * it, and when it is busy the packet is refused and retried a cycle
+ * later. Snoops cannot be refused, so they must cross towards the
+ * higher queue, which is the case when the memory system is simulated
+ * by queue 0.
+ *
+ * Atomic and functional accesses migrate to the queue of the other side.
+ * Memory backdoors are passed through, so that a CPU can access memory
+ * without crossing queues at all.
+ */
+class CrossQueueBridge : public ClockedObject
+{
+  protected:
+    class CPUSidePort : public ResponsePort
+    {
+      private:
+        CrossQueueBridge &bridge;
+
+      public:
+        CPUSidePort(const std::string &_name, CrossQueueBridge &_bridge);
+
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override;
+        bool recvTimingSnoopResp(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        Tick recvAtomicBackdoor(PacketPtr pkt,
+                                MemBackdoorPtr &backdoor) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    class MemSidePort : public RequestPort
+    {
+      private:
+        CrossQueueBridge &bridge;
+
+      public:
+        MemSidePort(const std::string &_name, CrossQueueBridge &_bridge);
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvTimingSnoopReq(PacketPtr pkt) override;
+        void recvReqRetry() override;
+        void recvRetrySnoopResp() override;
+        Tick recvAtomicSnoop(PacketPtr pkt) override;
+        void recvFunctionalSnoop(PacketPtr pkt) override;
+        void recvRangeChange() override;
+        bool isSnooping() const override;
+    };
+
+    /**
+     * Runs the caller on the event queue of one side of the bridge for
+     * the lifetime of the crossing. The queue is locked, unless the
+     * thread already holds it, and curEventQueue() switched to it.
+     */
+    class Crossing
+    {
+      private:
+        EventQueue *const prev;
+        EventQueue *const queue;
+        bool locked;
+        bool success;
+
+      public:
+        /**
+         * @param _queue Queue to run on.
+         * @param wait Whether to wait for the queue if another thread
+         *             holds it, rather than giving up.
+         */
+        Crossing(EventQueue *_queue, bool wait);
+        ~Crossing();
+
+        /** Whether the caller runs on the queue. */
+        bool entered() const { return success; }
+    };
+
+    CPUSidePort cpuSidePort;
+    MemSidePort memSidePort;
+
+    /** Event queue of the CPU side, the memory side uses our own. */
+    EventQueue *const cpuSideQueue;
+
+    /** Whether crossings towards each side wait for its queue. */
+    const bool memSideWaits;
+    const bool cpuSideWaits;
+
+    /** Delay of the packets crossing the bridge. */
+    const Tick delay;
+
+    /** Sends a retry to the other side, possibly after a refusal. */
+    void sendRetryReq();
+    void sendRetrySnoopResp();
+    void sendRetryResp();
+
+    EventFunctionWrapper retryReqEvent;
+    EventFunctionWrapper retrySnoopRespEvent;
+    EventFunctionWrapper retryRespEvent;
+
+    /**
+     * Attempts a retry again a cycle later on the current queue, when
+     * the queue of the other side is busy.
+     */
+    void retryLater(Event &event);
+
+    /**
+     * Stats of packets crossing the bridge, only updated while holding
+     * the queue of the CPU side.
+     */
+    struct CrossQueueBridgeStats : public statistics::Group
+    {
+        CrossQueueBridgeStats(CrossQueueBridge &bridge);
+
+        statistics::Scalar reqs;
+        statistics::Scalar reqsRefused;
+        statistics::Scalar resps;
+        statistics::Scalar snoops;
+        statistics::Scalar snoopResps;
+    } stats;
+
+  public:
+    CrossQueueBridge(const CrossQueueBridgeParams &p);
+
+    void init() override;
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+};
+
+} // namespace gem5
+
+#endif //__MEM_CROSS_QUEUE_BRIDGE_HH__
@@ -70,6 +70,9 @@ MessageBuffer::MessageBuffer(const Params &p)
     ADD_STAT(m_stall_time, "Average number of cycles messages are stalled in "
                            "this MB"),
     ADD_STAT(m_stall_count, "Number of times messages were stalled"),
+    ADD_STAT(m_stall_wait_time, statistics::units::Tick::get(),
+             "Ticks messages waited in the stall map before being "
+             "reanalyzed"),
     ADD_STAT(m_occupancy, "Average occupancy of buffer capacity")
 {
     m_msg_counter = 0;
@@ -81,6 +84,8 @@ MessageBuffer::MessageBuffer(const Params &p)
     m_priority_rank = 0;
 
     m_stall_msg_map.clear();
+    m_stall_list_head = nullptr;
+    m_stall_list_tail = nullptr;
     m_input_link_id = 0;
     m_vnet_id = 0;
 
@@ -99,6 +104,10 @@ MessageBuffer::MessageBuffer(const Params &p)
     m_stall_count
         .flags(statistics::nozero);
 
+    m_stall_wait_time
+        .init(10)
+        .flags(statistics::nozero);
+
     m_occupancy
         .flags(statistics::nozero);
 
@@ -356,22 +365,57 @@ MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
 }
 
 void
-MessageBuffer::reanalyzeList(std::list<MsgPtr> &lt, Tick schdTick)
+MessageBuffer::pushToHeap(std::vector<MsgPtr>::iterator first)
 {
-    while (!lt.empty()) {
-        MsgPtr m = lt.front();
-        assert(m->getLastEnqueueTime() <= schdTick);
-
-        m_prio_heap.push_back(m);
-        push_heap(m_prio_heap.begin(), m_prio_heap.end(),
+    // Restore the heap property after appending messages to the heap. When
+    // many messages were appended, rebuilding the heap is cheaper than
+    // sifting up every one of them.
+    auto num_new = m_prio_heap.end() - first;
+    if (num_new > first - m_prio_heap.begin()) {
+        make_heap(m_prio_heap.begin(), m_prio_heap.end(),
                   std::greater<MsgPtr>());
+    } else {
+        for (auto it = first; it != m_prio_heap.end(); ++it) {
+            push_heap(m_prio_heap.begin(), it + 1, std::greater<MsgPtr>());
+        }
+    }
+}
 
-        m_consumer->scheduleEventAbsolute(schdTick);
+void
+MessageBuffer::reanalyzeList(StallList &lt, Tick schdTick)
+{
+    for (MsgPtr &m : lt.msgs) {
+        assert(m->getLastEnqueueTime() <= schdTick);
+        m_stall_wait_time.sample(schdTick - m->getLastStallTime());
 
         DPRINTF(RubyQueue, "Requeue arrival_time: %lld, Message: %s\n",
             schdTick, *(m.get()));
 
-        lt.pop_front();
+        m_prio_heap.push_back(std::move(m));
+    }
+
+    if (!lt.msgs.empty()) {
+        m_consumer->scheduleEventAbsolute(schdTick);
+    }
+
+    m_stall_map_size -= lt.msgs.size();
+    assert(m_stall_map_size >= 0);
+    lt.msgs.clear();
+}
+
+void
+MessageBuffer::unlinkStallList(StallList &lt)
+{
+    if (lt.prev) {
+        lt.prev->next = lt.next;
+    } else {
+        m_stall_list_head = lt.next;
+    }
+
+    if (lt.next) {
+        lt.next->prev = lt.prev;
+    } else {
+        m_stall_list_tail = lt.prev;
     }
 }
 
@@ -379,7 +423,8 @@ void
 MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
 {
     DPRINTF(RubyQueue, "ReanalyzeMessages %#x\n", addr);
-    assert(m_stall_msg_map.count(addr) > 0);
+    auto it = m_stall_msg_map.find(addr);
+    assert(it != m_stall_msg_map.end());
 
     //
     // Put all stalled messages associated with this address back on the
@@ -387,10 +432,12 @@ MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle
     //
-    m_stall_map_size -= m_stall_msg_map[addr].size();
-    assert(m_stall_map_size >= 0);
-    reanalyzeList(m_stall_msg_map[addr], current_time);
-    m_stall_msg_map.erase(addr);
+    auto first = m_prio_heap.size();
+    reanalyzeList(it->second, current_time);
+    pushToHeap(m_prio_heap.begin() + first);
+
+    unlinkStallList(it->second);
+    m_stall_msg_map.erase(it);
 }
 
 void
@@ -404,13 +451,15 @@ MessageBuffer::reanalyzeAllMessages(Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle.
     //
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
-         map_iter != m_stall_msg_map.end(); ++map_iter) {
-        m_stall_map_size -= map_iter->second.size();
-        assert(m_stall_map_size >= 0);
-        reanalyzeList(map_iter->second, current_time);
+    auto first = m_prio_heap.size();
+    for (StallList *lt = m_stall_list_head; lt; lt = lt->next) {
+        reanalyzeList(*lt, current_time);
     }
+    pushToHeap(m_prio_heap.begin() + first);
+
     m_stall_msg_map.clear();
+    m_stall_list_head = nullptr;
+    m_stall_list_tail = nullptr;
 }
 
 void
@@ -430,7 +479,22 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
     // Instead the controller is responsible to call reanalyzeMessages when
     // these addresses change state.
     //
-    (m_stall_msg_map[addr]).push_back(message);
+    auto ret = m_stall_msg_map.emplace(addr, StallList());
+    StallList &lt = ret.first->second;
+    if (ret.second) {
+        // first message stalled on this line, append it to the list of
+        // stalled lines
+        lt.prev = m_stall_list_tail;
+        if (m_stall_list_tail) {
+            m_stall_list_tail->next = &lt;
+        } else {
+            m_stall_list_head = &lt;
+        }
+        m_stall_list_tail = &lt;
+    }
+
+    message->setLastStallTime(current_time);
+    lt.msgs.push_back(std::move(message));
     m_stall_map_size++;
     m_stall_count++;
 }
@@ -513,14 +577,9 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
 
     // Check the stall queue and write any messages that may
     // correspond to the address in the packet.
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
-         map_iter != m_stall_msg_map.end();
-         ++map_iter) {
-
-        for (std::list<MsgPtr>::iterator it = (map_iter->second).begin();
-            it != (map_iter->second).end(); ++it) {
-
-            Message *msg = (*it).get();
+    for (StallList *lt = m_stall_list_head; lt; lt = lt->next) {
+        for (MsgPtr &stalled_msg : lt->msgs) {
+            Message *msg = stalled_msg.get();
             if (is_read && !mask && msg->functionalRead(pkt))
                 return 1;
             else if (is_read && mask && msg->functionalRead(pkt, *mask))
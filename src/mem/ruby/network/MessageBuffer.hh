@@ -185,7 +185,11 @@ class MessageBuffer : public SimObject
     }
 
   private:
-    void reanalyzeList(std::list<MsgPtr> &, Tick);
+    struct StallList;
+
+    void reanalyzeList(StallList &, Tick);
+    void pushToHeap(std::vector<MsgPtr>::iterator first);
+    void unlinkStallList(StallList &);
 
     uint32_t functionalAccess(Packet *pkt, bool is_read, WriteMask *mask);
 
@@ -197,9 +201,22 @@ class MessageBuffer : public SimObject
 
     std::function<void()> m_dequeue_callback;
 
-    // use a std::map for the stalled messages as this container is
-    // sorted and ensures a well-defined iteration order
-    typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
+    /**
+     * The messages stalled on a line. The lists of all stalled lines are
+     * also linked together in the order in which the lines were first
+     * stalled, which gives reanalyzeAllMessages and functional accesses a
+     * well-defined iteration order without keeping the map sorted.
+     */
+    struct StallList
+    {
+        std::vector<MsgPtr> msgs;
+        StallList *prev = nullptr;
+        StallList *next = nullptr;
+    };
+
+    // the elements of an unordered_map are never moved, so the links
+    // between the stall lists stay valid when the map is rehashed
+    typedef std::unordered_map<Addr, StallList> StallMsgMapType;
 
     /**
      * A map from line addresses to lists of stalled messages for that line.
@@ -216,6 +233,10 @@ class MessageBuffer : public SimObject
      */
     StallMsgMapType m_stall_msg_map;
 
+    //! First and last stalled line, in the order they were first stalled
+    StallList *m_stall_list_head;
+    StallList *m_stall_list_tail;
+
     /**
      * A map from line addresses to corresponding vectors of messages that
      * are deferred for enqueueing. Messages in this map are waiting to be
@@ -267,6 +288,7 @@ class MessageBuffer : public SimObject
     statistics::Average m_buf_msgs;
     statistics::Average m_stall_time;
     statistics::Scalar m_stall_count;
+    statistics::Histogram m_stall_wait_time;
     statistics::Formula m_occupancy;
 };
 
@@ -70,6 +70,7 @@ AbstractController::AbstractController(const Params &p)
         // of this particular type.
         statistics::registerDumpCallback([this]() { collateStats(); });
     }
+    statistics::registerDumpCallback([this]() { collateStallHotLines(); });
 }
 
 void
@@ -118,6 +119,7 @@ AbstractController::resetStats()
     for (uint32_t i = 0; i < size; i++) {
         stats.delayVCHistogram[i]->reset();
     }
+    m_stallCount.clear();
 }
 
 void
@@ -134,9 +136,21 @@ AbstractController::profileMsgDelay(uint32_t virtualNetwork, Cycles delay)
     stats.delayVCHistogram[virtualNetwork]->sample(delay);
 }
 
+void
+AbstractController::collateStallHotLines()
+{
+    const auto lines = m_stallCount.top(numStallHotLines);
+    for (int i = 0; i < numStallHotLines; ++i) {
+        const bool valid = i < (int)lines.size();
+        stats.stallHotLines[i] = valid ? lines[i].second : 0;
+        stats.stallHotLineAddrs[i] = valid ? lines[i].first : 0;
+    }
+}
+
 void
 AbstractController::stallBuffer(MessageBuffer* buf, Addr addr)
 {
+    m_stallCount.count(addr);
     if (m_waiting_buffers.count(addr) == 0) {
         MsgVecType* msgVec = new MsgVecType;
         msgVec->resize(m_in_ports, NULL);
@@ -456,10 +470,19 @@ ControllerStats::ControllerStats(statistics::Group *parent)
     : statistics::Group(parent),
       ADD_STAT(fullyBusyCycles,
                "cycles for which number of transistions == max transitions"),
+      ADD_STAT(stallHotLines, "stall_and_wait stalls of the most contended "
+                              "lines"),
+      ADD_STAT(stallHotLineAddrs, "addresses of the most contended lines"),
       ADD_STAT(delayHistogram, "delay_histogram")
 {
     fullyBusyCycles
         .flags(statistics::nozero);
+    stallHotLines
+        .init(numStallHotLines)
+        .flags(statistics::nozero);
+    stallHotLineAddrs
+        .init(numStallHotLines)
+        .flags(statistics::nozero);
     delayHistogram
         .flags(statistics::nozero);
 }
@@ -56,8 +56,10 @@
 #include "mem/ruby/common/DataBlock.hh"
 #include "mem/ruby/common/Histogram.hh"
 #include "mem/ruby/common/MachineID.hh"
+#include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
 #include "mem/ruby/protocol/AccessPermission.hh"
+#include "mem/ruby/structures/HotLineTable.hh"
 #include "mem/ruby/system/CacheRecorder.hh"
 #include "params/RubyController.hh"
 #include "sim/clocked_object.hh"
@@ -152,6 +154,25 @@ class AbstractController : public ClockedObject, public Consumer
                                  const bool& was_miss)
     { }
 
+    //! Cache warmup from a snapshot installs lines directly, without
+    //! going through the sequencers. The holders are the controllers
+    //! with a CPU sequencer that end up with a copy, the fetchers are the
+    //! holders that keep it as an instruction, and a writable line has a
+    //! single holder. All controllers are first asked whether they can
+    //! take the line, and only install it if every one of them can.
+    //! Controllers with no state for the line must accept it. Protocols
+    //! that do not override these have their snapshot replayed through
+    //! the sequencers instead.
+    virtual bool warmupCanInstall(const Addr& addr, const NetDest& holders,
+                                  const NetDest& fetchers,
+                                  const bool& writable)
+    { return false; }
+    virtual void warmupInstall(const Addr& addr, const DataBlock& data,
+                               const NetDest& holders,
+                               const NetDest& fetchers,
+                               const bool& writable)
+    { panic("warmupInstall(Addr,...) not implemented"); }
+
     //! Function for collating statistics from all the controllers of this
     //! particular type. This function should only be called from the
     //! version 0 of this controller type.
@@ -227,6 +248,23 @@ class AbstractController : public ClockedObject, public Consumer
     std::unordered_map<Addr, TransMapPair> m_inTrans;
     std::unordered_map<Addr, TransMapPair> m_outTrans;
 
+    // Tick at which lines currently in a transient state entered it
+    std::unordered_map<Addr, Tick> m_transientSince;
+
+    //! Number of lines reported in stats.stallHotLines
+    static const int numStallHotLines = 8;
+
+    //! Number of lines whose stalls are counted, the most stalled lines
+    //! are kept (see HotLineTable)
+    static const int stallHotLineCapacity = 64;
+
+    // Number of stall_and_wait stalls per line, reported for the most
+    // contended lines in stats.stallHotLines
+    HotLineTable m_stallCount{stallHotLineCapacity};
+
+    //! Fills stats.stallHotLines from m_stallCount before a stats dump
+    void collateStallHotLines();
+
     /**
      * Profiles an event that initiates a protocol transactions for a specific
      * line (e.g. events triggered by incoming request messages).
@@ -297,6 +335,36 @@ class AbstractController : public ClockedObject, public Consumer
         m_outTrans.erase(iter);
     }
 
+    /**
+     * Profiles the time a line spends in transient states. Called by the
+     * generated controllers whenever a transition changes the state of a
+     * line. A histogram of the residency is kept for every transient state.
+     *
+     * @param addr address of the line
+     * @param state state the line is leaving
+     * @param was_transient true if state is a transient state
+     * @param is_transient true if the state being entered is transient
+     */
+    void profileStateChange(Addr addr, unsigned state, bool was_transient,
+                            bool is_transient)
+    {
+        if (was_transient) {
+            auto iter = m_transientSince.find(addr);
+            if (iter != m_transientSince.end()) {
+                stats.transientStateLatHist[state]->sample(
+                    ticksToCycles(curTick() - iter->second));
+                if (is_transient) {
+                    iter->second = curTick();
+                } else {
+                    m_transientSince.erase(iter);
+                }
+                return;
+            }
+        }
+        if (is_transient)
+            m_transientSince[addr] = curTick();
+    }
+
     void stallBuffer(MessageBuffer* buf, Addr addr);
     void wakeUpBuffer(MessageBuffer* buf, Addr addr);
     void wakeUpBuffers(Addr addr);
@@ -392,10 +460,20 @@ class AbstractController : public ClockedObject, public Consumer
         std::vector<statistics::Histogram*> outTransLatHist;
         std::vector<statistics::Scalar*> outTransLatHistRetries;
 
+        // Initialized by the SLICC compiler for all states, only transient
+        // states are sampled. Only histograms with samples will appear in
+        // the stats.
+        std::vector<statistics::Histogram*> transientStateLatHist;
+
         //! Counter for the number of cycles when the transitions carried out
         //! were equal to the maximum allowed
         statistics::Scalar fullyBusyCycles;
 
+        //! Stall_and_wait counts of the most contended lines, most
+        //! contended first, and the addresses of those lines
+        statistics::Vector stallHotLines;
+        statistics::Vector stallHotLineAddrs;
+
         //! Histogram for profiling delay for the messages this controller
         //! cares for
         statistics::Histogram delayHistogram;
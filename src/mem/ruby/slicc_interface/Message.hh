@@ -65,7 +65,7 @@ class Message
     Message(Tick curTime)
         : m_time(curTime),
           m_LastEnqueueTime(curTime),
-          m_DelayedTicks(0), m_msg_counter(0)
+          m_DelayedTicks(0), m_LastStallTime(0), m_msg_counter(0)
     { }
 
     Message(const Message &other) = default;
@@ -106,6 +106,9 @@ class Message
     void setLastEnqueueTime(const Tick& time) { m_LastEnqueueTime = time; }
     Tick getLastEnqueueTime() const {return m_LastEnqueueTime;}
 
+    void setLastStallTime(const Tick& time) { m_LastStallTime = time; }
+    Tick getLastStallTime() const { return m_LastStallTime; }
+
     Tick getTime() const { return m_time; }
     void setMsgCounter(uint64_t c) { m_msg_counter = c; }
     uint64_t getMsgCounter() const { return m_msg_counter; }
@@ -125,6 +128,7 @@ class Message
     Tick m_time;
     Tick m_LastEnqueueTime; // my last enqueue time
     Tick m_DelayedTicks; // my delayed cycles
+    Tick m_LastStallTime; // last time I was stalled in a MessageBuffer
     uint64_t m_msg_counter; // FIXME, should this be a 64-bit value?
 
     // Variables for required network traversal
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_HOTLINETABLE_HH__
+#define __MEM_RUBY_STRUCTURES_HOTLINETABLE_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "mem/ruby/common/Address.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Counts events per cache line in a bounded table, to find the lines
+ * with the most events (e.g., stalls) without keeping a counter for
+ * every line ever seen. It uses the Space-Saving algorithm: when the
+ * table is full, a new line replaces the line with the lowest count and
+ * inherits that count plus one. Any line with more than 1 / capacity of
+ * the events is then guaranteed to be in the table, and a count exceeds
+ * the true count of its line by at most the count it inherited.
+ */
+class HotLineTable
+{
+  public:
+    explicit HotLineTable(int capacity) : capacity(capacity)
+    {
+        assert(capacity > 0);
+        entries.reserve(capacity);
+        index.reserve(capacity);
+    }
+
+    /** Count an event on a line. */
+    void
+    count(Addr addr)
+    {
+        auto it = index.find(addr);
+        if (it != index.end()) {
+            entries[it->second].second++;
+            return;
+        }
+
+        if (entries.size() < capacity) {
+            index.emplace(addr, entries.size());
+            entries.emplace_back(addr, 1);
+            return;
+        }
+
+        auto min = std::min_element(entries.begin(), entries.end(),
+            [](const Entry &a, const Entry &b) {
+                return a.second < b.second;
+            });
+        index.erase(min->first);
+        index.emplace(addr, min - entries.begin());
+        *min = Entry(addr, min->second + 1);
+    }
+
+    /**
+     * The lines with the highest counts, highest first. Ties are broken
+     * by address so the order does not depend on the history of the
+     * table.
+     */
+    std::vector<std::pair<Addr, uint64_t>>
+    top(int n) const
+    {
+        std::vector<Entry> sorted(entries);
+        n = std::min<int>(n, sorted.size());
+        std::partial_sort(sorted.begin(), sorted.begin() + n, sorted.end(),
+            [](const Entry &a, const Entry &b) {
+                return a.second != b.second ? a.second > b.second
+                                            : a.first < b.first;
+            });
+        sorted.resize(n);
+        return sorted;
+    }
+
+    int size() const { return entries.size(); }
+
+    void
+    clear()
+    {
+        entries.clear();
+        index.clear();
+    }
+
+  private:
+    typedef std::pair<Addr, uint64_t> Entry;
+
+    const size_t capacity;
+    std::vector<Entry> entries;
+    std::unordered_map<Addr, size_t> index;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_HOTLINETABLE_HH__
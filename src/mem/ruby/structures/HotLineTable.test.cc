@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "mem/ruby/structures/HotLineTable.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+typedef std::vector<std::pair<Addr, uint64_t>> Lines;
+
+/** Counts are exact while the table is not full. */
+TEST(HotLineTableTest, ExactCounts)
+{
+    HotLineTable table(4);
+    for (int i = 0; i < 3; i++)
+        table.count(0x40);
+    table.count(0x80);
+    for (int i = 0; i < 5; i++)
+        table.count(0xc0);
+
+    EXPECT_EQ(table.size(), 3);
+    EXPECT_EQ(table.top(8), Lines({{0xc0, 5}, {0x40, 3}, {0x80, 1}}));
+    EXPECT_EQ(table.top(2), Lines({{0xc0, 5}, {0x40, 3}}));
+    EXPECT_EQ(table.top(0), Lines());
+}
+
+/** Lines with the same count are ordered by address. */
+TEST(HotLineTableTest, Ties)
+{
+    HotLineTable table(4);
+    table.count(0x100);
+    table.count(0x40);
+    table.count(0x80);
+    EXPECT_EQ(table.top(3), Lines({{0x40, 1}, {0x80, 1}, {0x100, 1}}));
+}
+
+/** A new line replaces the least counted one and inherits its count. */
+TEST(HotLineTableTest, Replace)
+{
+    HotLineTable table(2);
+    table.count(0x40);
+    table.count(0x40);
+    table.count(0x80);
+    table.count(0xc0);
+
+    EXPECT_EQ(table.size(), 2);
+    EXPECT_EQ(table.top(2), Lines({{0x40, 2}, {0xc0, 2}}));
+
+    // The replaced line starts over from the lowest count
+    table.count(0xc0);
+    table.count(0x80);
+    EXPECT_EQ(table.top(2), Lines({{0x80, 3}, {0xc0, 3}}));
+}
+
+/** The table never grows past its capacity, and keeps the hot lines. */
+TEST(HotLineTableTest, Bounded)
+{
+    HotLineTable table(16);
+    const uint64_t events = 100000;
+    for (uint64_t i = 0; i < events; i++) {
+        // One in four events is on one of two hot lines, the others on
+        // lines that are never seen twice
+        if (i % 8 == 0)
+            table.count(0x1000);
+        else if (i % 8 == 4)
+            table.count(0x2000);
+        else
+            table.count(0x10000 + i * 0x40);
+        ASSERT_LE(table.size(), 16);
+    }
+
+    const Lines top = table.top(2);
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].first, 0x1000u);
+    EXPECT_EQ(top[1].first, 0x2000u);
+    // Counts are overestimated by at most the events over the capacity
+    EXPECT_GE(top[0].second, events / 8);
+    EXPECT_LE(top[0].second, events / 8 + events / 16);
+    EXPECT_GE(top[1].second, events / 8);
+    EXPECT_LE(top[1].second, events / 8 + events / 16);
+}
+
+TEST(HotLineTableTest, Clear)
+{
+    HotLineTable table(2);
+    table.count(0x40);
+    table.count(0x80);
+    table.clear();
+    EXPECT_EQ(table.size(), 0);
+    EXPECT_EQ(table.top(2), Lines());
+
+    table.count(0xc0);
+    EXPECT_EQ(table.top(2), Lines({{0xc0, 1}}));
+}
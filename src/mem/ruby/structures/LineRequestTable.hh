@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_LINEREQUESTTABLE_HH__
+#define __MEM_RUBY_STRUCTURES_LINEREQUESTTABLE_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "mem/ruby/common/Address.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Table of the outstanding requests of a sequencer, kept as a FIFO per
+ * cache line. It replaces a node based map of lists: the lines are held
+ * in an open addressed (linear probing) index and the requests in a pool
+ * of nodes allocated up front for the expected number of outstanding
+ * requests, so inserting and completing requests does not allocate.
+ *
+ * The table grows if more requests than the given capacity are inserted
+ * (e.g., HTM aborts bypass the sequencer limit). References to requests
+ * stay valid until the request is popped, even if other requests are
+ * inserted meanwhile, as callbacks may issue new requests while walking
+ * the FIFO of a line.
+ */
+template <class T>
+class LineRequestTable
+{
+  private:
+    struct Node
+    {
+        std::optional<T> value;
+        int next = -1;
+    };
+
+    struct Slot
+    {
+        Addr addr = 0;
+        int head = -1;
+        int tail = -1;
+        int size = 0;
+
+        bool valid() const { return head >= 0; }
+    };
+
+  public:
+    /** Iterator over the requests of a line, oldest first. */
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        iterator(LineRequestTable *table, int node)
+            : table(table), node(node)
+        {}
+
+        T &operator*() const { return *table->m_nodes[node].value; }
+        T *operator->() const { return &*table->m_nodes[node].value; }
+
+        iterator &
+        operator++()
+        {
+            node = table->m_nodes[node].next;
+            return *this;
+        }
+
+        iterator
+        operator++(int)
+        {
+            iterator it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool operator==(const iterator &o) const { return node == o.node; }
+        bool operator!=(const iterator &o) const { return node != o.node; }
+
+      private:
+        LineRequestTable *table;
+        int node;
+    };
+
+    /**
+     * Handle to the FIFO of one line, providing the subset of the
+     * std::list interface the sequencers use. A line is present in the
+     * table only while it has requests, so popping the last request
+     * removes it. The handle looks the line up on every access and can
+     * be used across insertions of other lines.
+     */
+    class Line
+    {
+      public:
+        Line(LineRequestTable *table, Addr addr) : table(table), addr(addr)
+        {}
+
+        int
+        size() const
+        {
+            int idx = table->find(addr);
+            return idx < 0 ? 0 : table->m_slots[idx].size;
+        }
+
+        bool empty() const { return size() == 0; }
+
+        T &
+        front() const
+        {
+            int idx = table->find(addr);
+            assert(idx >= 0);
+            return *table->m_nodes[table->m_slots[idx].head].value;
+        }
+
+        template <class... Args>
+        T &
+        emplace_back(Args&&... args) const
+        {
+            return table->emplaceBack(addr, std::forward<Args>(args)...);
+        }
+
+        void
+        push_back(const T &value) const
+        {
+            table->emplaceBack(addr, value);
+        }
+
+        void pop_front() const { table->popFront(addr); }
+
+        iterator
+        begin() const
+        {
+            int idx = table->find(addr);
+            return iterator(table, idx < 0 ? -1 : table->m_slots[idx].head);
+        }
+
+        iterator end() const { return iterator(table, -1); }
+
+      private:
+        LineRequestTable *table;
+        Addr addr;
+    };
+
+    /** Iterator over the lines of the table, in no particular order. */
+    class line_iterator
+    {
+      public:
+        line_iterator(LineRequestTable *table, int slot)
+            : table(table), slot(slot)
+        {
+            skipInvalid();
+        }
+
+        std::pair<Addr, Line>
+        operator*() const
+        {
+            Addr addr = table->m_slots[slot].addr;
+            return std::make_pair(addr, Line(table, addr));
+        }
+
+        line_iterator &
+        operator++()
+        {
+            slot++;
+            skipInvalid();
+            return *this;
+        }
+
+        bool
+        operator!=(const line_iterator &o) const
+        {
+            return slot != o.slot;
+        }
+
+      private:
+        void
+        skipInvalid()
+        {
+            while (slot < table->m_slots.size() &&
+                   !table->m_slots[slot].valid()) {
+                slot++;
+            }
+        }
+
+        LineRequestTable *table;
+        int slot;
+    };
+
+    /**
+     * @param capacity Number of requests that can be outstanding without
+     *                 allocating memory.
+     */
+    explicit LineRequestTable(int capacity)
+        : m_nodes(std::max(capacity, 1)), m_freeNode(0), m_numLines(0)
+    {
+        for (int i = 0; i < m_nodes.size(); i++)
+            m_nodes[i].next = i + 1 < m_nodes.size() ? i + 1 : -1;
+
+        // Keep the index at most half full so probe sequences stay short
+        m_slots.resize(size_t(1) << ceilLog2(2 * m_nodes.size()));
+        m_mask = m_slots.size() - 1;
+    }
+
+    /** The FIFO of a line; like std::map, the line need not exist. */
+    Line operator[](Addr addr) { return Line(this, addr); }
+
+    /** Number of requests outstanding for a line (0 if absent). */
+    int
+    count(Addr addr) const
+    {
+        int idx = find(addr);
+        return idx < 0 ? 0 : m_slots[idx].size;
+    }
+
+    /** Number of lines with outstanding requests. */
+    int size() const { return m_numLines; }
+    bool empty() const { return m_numLines == 0; }
+
+    line_iterator
+    begin() const
+    {
+        return line_iterator(const_cast<LineRequestTable *>(this), 0);
+    }
+
+    line_iterator
+    end() const
+    {
+        return line_iterator(const_cast<LineRequestTable *>(this),
+                             m_slots.size());
+    }
+
+  private:
+    size_t
+    hash(Addr addr) const
+    {
+        // Fibonacci hashing spreads consecutive line addresses
+        return (addr * 0x9e3779b97f4a7c15ULL) >> 32 & m_mask;
+    }
+
+    int
+    find(Addr addr) const
+    {
+        for (size_t idx = hash(addr); m_slots[idx].valid();
+             idx = (idx + 1) & m_mask) {
+            if (m_slots[idx].addr == addr)
+                return idx;
+        }
+        return -1;
+    }
+
+    size_t
+    findOrInsert(Addr addr)
+    {
+        if (2 * (m_numLines + 1) > m_slots.size())
+            rehash(2 * m_slots.size());
+
+        size_t idx = hash(addr);
+        for (; m_slots[idx].valid(); idx = (idx + 1) & m_mask) {
+            if (m_slots[idx].addr == addr)
+                return idx;
+        }
+        m_slots[idx].addr = addr;
+        m_slots[idx].size = 0;
+        m_numLines++;
+        return idx;
+    }
+
+    void
+    rehash(size_t num_slots)
+    {
+        std::vector<Slot> old_slots(num_slots);
+        old_slots.swap(m_slots);
+        m_mask = m_slots.size() - 1;
+
+        for (const auto &slot : old_slots) {
+            if (!slot.valid())
+                continue;
+            size_t idx = hash(slot.addr);
+            while (m_slots[idx].valid())
+                idx = (idx + 1) & m_mask;
+            m_slots[idx] = slot;
+        }
+    }
+
+    /** Remove a slot, shifting back the entries probed past it. */
+    void
+    erase(size_t idx)
+    {
+        size_t next = idx;
+        while (true) {
+            next = (next + 1) & m_mask;
+            if (!m_slots[next].valid())
+                break;
+            size_t home = hash(m_slots[next].addr);
+            // Leave the entry alone if its home is cyclically in
+            // (idx, next], i.e., it would still be found
+            bool in_place = idx <= next ? (idx < home && home <= next)
+                                        : (idx < home || home <= next);
+            if (!in_place) {
+                m_slots[idx] = m_slots[next];
+                idx = next;
+            }
+        }
+        m_slots[idx].head = -1;
+        m_numLines--;
+    }
+
+    template <class... Args>
+    T &
+    emplaceBack(Addr addr, Args&&... args)
+    {
+        if (m_freeNode < 0) {
+            // Growing a deque at the end keeps references to the other
+            // nodes valid
+            m_freeNode = m_nodes.size();
+            m_nodes.resize(2 * m_nodes.size());
+            for (int i = m_freeNode; i < m_nodes.size(); i++)
+                m_nodes[i].next = i + 1 < m_nodes.size() ? i + 1 : -1;
+        }
+
+        int node = m_freeNode;
+        m_freeNode = m_nodes[node].next;
+        m_nodes[node].value.emplace(std::forward<Args>(args)...);
+        m_nodes[node].next = -1;
+
+        Slot &slot = m_slots[findOrInsert(addr)];
+        if (slot.valid())
+            m_nodes[slot.tail].next = node;
+        else
+            slot.head = node;
+        slot.tail = node;
+        slot.size++;
+
+        return *m_nodes[node].value;
+    }
+
+    void
+    popFront(Addr addr)
+    {
+        int idx = find(addr);
+        assert(idx >= 0);
+        Slot &slot = m_slots[idx];
+
+        int node = slot.head;
+        slot.head = m_nodes[node].next;
+        slot.size--;
+        m_nodes[node].value.reset();
+        m_nodes[node].next = m_freeNode;
+        m_freeNode = node;
+
+        if (slot.size == 0)
+            erase(idx);
+    }
+
+    std::deque<Node> m_nodes;
+    int m_freeNode;
+
+    std::vector<Slot> m_slots;
+    size_t m_mask;
+    int m_numLines;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_LINEREQUESTTABLE_HH__
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "mem/ruby/structures/LineRequestTable.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+typedef LineRequestTable<int> Table;
+
+/** Contents of a line, oldest request first. */
+static std::vector<int>
+contents(Table &table, Addr addr)
+{
+    std::vector<int> values;
+    for (int value : table[addr])
+        values.push_back(value);
+    return values;
+}
+
+/**
+ * Index slot a line is hashed to in a table with the given number of
+ * slots. It must match LineRequestTable::hash.
+ */
+static size_t
+homeSlot(Addr addr, size_t num_slots)
+{
+    return (addr * 0x9e3779b97f4a7c15ULL) >> 32 & (num_slots - 1);
+}
+
+/** Lines whose home is the given slot, so that they collide. */
+static std::vector<Addr>
+collidingLines(size_t slot, size_t num_slots, int count)
+{
+    std::vector<Addr> lines;
+    for (Addr addr = 0x40; lines.size() < count; addr += 0x40) {
+        if (homeSlot(addr, num_slots) == slot)
+            lines.push_back(addr);
+    }
+    return lines;
+}
+
+/** Requests are kept in order per line. */
+TEST(LineRequestTableTest, Insert)
+{
+    Table table(8);
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.count(0x40), 0);
+    EXPECT_TRUE(table[0x40].empty());
+
+    table[0x40].emplace_back(1);
+    table[0x80].push_back(2);
+    table[0x40].emplace_back(3);
+
+    EXPECT_EQ(table.size(), 2);
+    EXPECT_EQ(table.count(0x40), 2);
+    EXPECT_EQ(table.count(0x80), 1);
+    EXPECT_EQ(table[0x40].front(), 1);
+    EXPECT_EQ(contents(table, 0x40), std::vector<int>({1, 3}));
+    EXPECT_EQ(contents(table, 0x80), std::vector<int>({2}));
+
+    // Looking up an absent line does not insert it
+    EXPECT_EQ(contents(table, 0xc0), std::vector<int>());
+    EXPECT_EQ(table.size(), 2);
+}
+
+/** Popping the last request of a line removes the line. */
+TEST(LineRequestTableTest, Erase)
+{
+    Table table(8);
+    table[0x40].emplace_back(1);
+    table[0x40].emplace_back(2);
+    table[0x80].emplace_back(3);
+
+    table[0x40].pop_front();
+    EXPECT_EQ(table.count(0x40), 1);
+    EXPECT_EQ(table[0x40].front(), 2);
+    EXPECT_EQ(table.size(), 2);
+
+    table[0x40].pop_front();
+    EXPECT_EQ(table.count(0x40), 0);
+    EXPECT_EQ(table.size(), 1);
+    EXPECT_EQ(contents(table, 0x80), std::vector<int>({3}));
+
+    table[0x80].pop_front();
+    EXPECT_TRUE(table.empty());
+
+    // Freed requests are reused
+    table[0x40].emplace_back(4);
+    EXPECT_EQ(contents(table, 0x40), std::vector<int>({4}));
+}
+
+/**
+ * Lines colliding in the last slot of the index probe past the end of
+ * the table and wrap around, and removing any of them must shift the
+ * others back so that they are still found.
+ */
+TEST(LineRequestTableTest, Wraparound)
+{
+    // A capacity of 4 requests gives an index of 8 slots
+    const size_t num_slots = 8;
+    std::vector<Addr> lines = collidingLines(num_slots - 1, num_slots, 3);
+    Addr other = collidingLines(0, num_slots, 1)[0];
+
+    for (int erased = 0; erased < 3; erased++) {
+        Table table(4);
+        for (int i = 0; i < 3; i++)
+            table[lines[i]].emplace_back(i);
+        table[other].emplace_back(3);
+        ASSERT_EQ(table.size(), 4);
+
+        table[lines[erased]].pop_front();
+        EXPECT_EQ(table.size(), 3);
+        for (int i = 0; i < 3; i++) {
+            if (i == erased) {
+                EXPECT_EQ(table.count(lines[i]), 0);
+            } else {
+                EXPECT_EQ(contents(table, lines[i]), std::vector<int>({i}));
+            }
+        }
+        EXPECT_EQ(contents(table, other), std::vector<int>({3}));
+
+        int num_lines = 0;
+        for (auto line : table) {
+            EXPECT_EQ(line.second.size(), 1);
+            num_lines++;
+        }
+        EXPECT_EQ(num_lines, 3);
+    }
+}
+
+/**
+ * Inserting more lines and requests than the capacity grows the index
+ * and the request pool, keeping the contents and the references to
+ * requests that are still outstanding.
+ */
+TEST(LineRequestTableTest, Rehash)
+{
+    Table table(1);
+    int &first = table[0x40].emplace_back(0);
+
+    for (int i = 1; i < 100; i++)
+        table[0x40 * (i % 50 + 1)].emplace_back(i);
+
+    EXPECT_EQ(&first, &table[0x40].front());
+    EXPECT_EQ(table.size(), 50);
+    for (int line = 0; line < 50; line++) {
+        EXPECT_EQ(contents(table, 0x40 * (line + 1)),
+                  std::vector<int>({line, line + 50}))
+            << "line " << line;
+    }
+
+    for (int line = 0; line < 50; line += 2) {
+        table[0x40 * (line + 1)].pop_front();
+        table[0x40 * (line + 1)].pop_front();
+    }
+    EXPECT_EQ(table.size(), 25);
+    for (int line = 1; line < 50; line += 2) {
+        EXPECT_EQ(contents(table, 0x40 * (line + 1)),
+                  std::vector<int>({line, line + 50}));
+    }
+}
+
+/** Random inserts and pops match a map of FIFOs. */
+TEST(LineRequestTableTest, Random)
+{
+    Table table(4);
+    std::map<Addr, std::deque<int>> model;
+    std::mt19937 rng(1);
+
+    for (int i = 0; i < 10000; i++) {
+        Addr addr = 0x40 * (rng() % 16);
+        if (rng() % 2) {
+            table[addr].emplace_back(i);
+            model[addr].push_back(i);
+        } else if (!model[addr].empty()) {
+            EXPECT_EQ(table[addr].front(), model[addr].front());
+            table[addr].pop_front();
+            model[addr].pop_front();
+        }
+
+        int num_lines = 0;
+        for (const auto &line : model) {
+            EXPECT_EQ(table.count(line.first), line.second.size());
+            num_lines += !line.second.empty();
+        }
+        ASSERT_EQ(table.size(), num_lines);
+    }
+}
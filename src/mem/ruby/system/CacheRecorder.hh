@@ -70,6 +70,48 @@ class TraceRecord
     void print(std::ostream& out) const;
 };
 
+/*!
+ * On-disk format of a cache snapshot, a compact description of the lines
+ * that should be cached when simulation starts. Unlike the traces stored
+ * in checkpoints, snapshots hold no data and are not tied to the Ruby
+ * configuration that produced them, so they can be written by any CPU or
+ * memory model doing functional warming (see util/ruby_cache_snapshot.py).
+ *
+ * A snapshot is a header followed by numRecords records, oldest access
+ * first. The file may be gzip compressed. Sequencer numbers index the
+ * controllers that have a CPU sequencer, in controller registration order.
+ */
+struct CacheSnapshotHeader
+{
+    static constexpr char Magic[8] = {'g', 'e', 'm', '5', 'c', 's', 'n', 'p'};
+    static constexpr uint32_t Version = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t blockSize;
+    uint64_t numRecords;
+};
+
+struct CacheSnapshotRecord
+{
+    enum Type : uint8_t
+    {
+        Load = 0,
+        Store = 1,
+        IFetch = 2
+    };
+
+    uint64_t addr;
+    uint32_t sequencer;
+    uint8_t type;
+    uint8_t pad[3];
+};
+
+static_assert(sizeof(CacheSnapshotHeader) == 24,
+              "Unexpected cache snapshot header layout");
+static_assert(sizeof(CacheSnapshotRecord) == 16,
+              "Unexpected cache snapshot record layout");
+
 class CacheRecorder
 {
   public:
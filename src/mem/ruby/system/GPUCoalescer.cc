@@ -191,6 +191,7 @@ GPUCoalescer::GPUCoalescer(const Params &p)
       issueEvent([this]{ completeIssue(); }, "Issue coalesced request",
                  false, Event::Progress_Event_Pri),
       uncoalescedTable(this),
+      coalescedTable(p.max_outstanding_requests),
       deadlockCheckEvent([this]{ wakeup(); }, "GPUCoalescer deadlock check"),
       gmTokenPort(name() + ".gmTokenPort", this)
 {
@@ -286,7 +287,7 @@ void
 GPUCoalescer::wakeup()
 {
     Cycles current_time = curCycle();
-    for (auto& requestList : coalescedTable) {
+    for (const auto& requestList : coalescedTable) {
         for (auto& req : requestList.second) {
             if (current_time - req->getIssueTime() > m_deadlock_threshold) {
                 std::stringstream ss;
@@ -314,7 +315,7 @@ GPUCoalescer::printRequestTable(std::stringstream& ss)
     ss << "Printing out " << coalescedTable.size()
        << " outstanding requests in the coalesced table\n";
 
-    for (auto& requestList : coalescedTable) {
+    for (const auto& requestList : coalescedTable) {
         for (auto& request : requestList.second) {
             ss << "\tAddr: " << printAddress(requestList.first) << "\n"
                << "\tInstruction sequence number: "
@@ -416,19 +417,17 @@ GPUCoalescer::writeCallback(Addr address,
     assert(address == makeLineAddress(address));
     assert(coalescedTable.count(address));
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = coalescedTable[address].front();
 
     hitCallback(crequest, mach, data, true, crequest->getIssueTime(),
                 forwardRequestTime, firstResponseTime, isRegion);
 
     // remove this crequest in coalescedTable
     delete crequest;
-    coalescedTable.at(address).pop_front();
+    coalescedTable[address].pop_front();
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
-    } else {
-        auto nextRequest = coalescedTable.at(address).front();
+    if (!coalescedTable[address].empty()) {
+        auto nextRequest = coalescedTable[address].front();
         issueRequest(nextRequest);
     }
 }
@@ -503,7 +502,7 @@ GPUCoalescer::readCallback(Addr address,
     assert(address == makeLineAddress(address));
     assert(coalescedTable.count(address));
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = coalescedTable[address].front();
     fatal_if(crequest->getRubyType() != RubyRequestType_LD,
              "readCallback received non-read type response\n");
 
@@ -514,18 +513,16 @@ GPUCoalescer::readCallback(Addr address,
                     forwardRequestTime, firstResponseTime, isRegion);
 
         delete crequest;
-        coalescedTable.at(address).pop_front();
-        if (coalescedTable.at(address).empty()) {
+        coalescedTable[address].pop_front();
+        if (coalescedTable[address].empty()) {
             break;
         }
 
-        crequest = coalescedTable.at(address).front();
+        crequest = coalescedTable[address].front();
     }
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
-    } else {
-        auto nextRequest = coalescedTable.at(address).front();
+    if (!coalescedTable[address].empty()) {
+        auto nextRequest = coalescedTable[address].front();
         issueRequest(nextRequest);
     }
 }
@@ -718,7 +715,7 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
     // coalescedTable and has the same sequence number, it can be coalesced.
     if (coalescedTable.count(line_addr)) {
         // Search for a previous coalesced request with the same seqNum.
-        auto& creqQueue = coalescedTable.at(line_addr);
+        auto creqQueue = coalescedTable[line_addr];
         auto citer = std::find_if(creqQueue.begin(), creqQueue.end(),
             [&](CoalescedRequest* c) { return c->getSeqNum() == seqNum; }
         );
@@ -743,7 +740,7 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
             // If there is no outstanding request for this line address,
             // create a new coalecsed request and issue it immediately.
             auto reqList = std::deque<CoalescedRequest*> { creq };
-            coalescedTable.insert(std::make_pair(line_addr, reqList));
+            coalescedTable[line_addr].push_back(creq);
             if (!coalescedReqs.count(seqNum)) {
                 coalescedReqs.insert(std::make_pair(seqNum, reqList));
             } else {
@@ -753,7 +750,7 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
             // The request is for a line address that is already outstanding
             // but for a different instruction. Add it as a new request to be
             // issued when the current outstanding request is completed.
-            coalescedTable.at(line_addr).push_back(creq);
+            coalescedTable[line_addr].push_back(creq);
             DPRINTF(GPUCoalescer, "found address 0x%X with new seqNum %d\n",
                     line_addr, seqNum);
         }
@@ -897,7 +894,7 @@ GPUCoalescer::atomicCallback(Addr address,
     assert(address == makeLineAddress(address));
     assert(coalescedTable.count(address));
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = coalescedTable[address].front();
 
     fatal_if((crequest->getRubyType() != RubyRequestType_ATOMIC &&
               crequest->getRubyType() != RubyRequestType_ATOMIC_RETURN &&
@@ -908,12 +905,10 @@ GPUCoalescer::atomicCallback(Addr address,
                 crequest->getIssueTime(), Cycles(0), Cycles(0), false);
 
     delete crequest;
-    coalescedTable.at(address).pop_front();
+    coalescedTable[address].pop_front();
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
-    } else {
-        auto nextRequest = coalescedTable.at(address).front();
+    if (!coalescedTable[address].empty()) {
+        auto nextRequest = coalescedTable[address].front();
         issueRequest(nextRequest);
     }
 }
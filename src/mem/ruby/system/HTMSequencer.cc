@@ -173,9 +173,9 @@ HTMSequencer::htmCallback(Addr address,
                mode == HtmCallbackMode_ST_FAIL) {
         // transaction failed
         assert(address == makeLineAddress(address));
-        assert(m_RequestTable.find(address) != m_RequestTable.end());
+        assert(m_RequestTable.count(address));
 
-        auto &seq_req_list = m_RequestTable[address];
+        auto seq_req_list = m_RequestTable[address];
         while (!seq_req_list.empty()) {
             SequencerRequest &request = seq_req_list.front();
 
@@ -200,10 +200,6 @@ HTMSequencer::htmCallback(Addr address,
             pkt = nullptr;
             seq_req_list.pop_front();
         }
-        // free all outstanding requests corresponding to this address
-        if (seq_req_list.empty()) {
-            m_RequestTable.erase(address);
-        }
     } else {
         panic("unrecognised HTM callback mode\n");
     }
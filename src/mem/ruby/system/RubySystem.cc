@@ -43,8 +43,12 @@
 #include <fcntl.h>
 #include <zlib.h>
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/intmath.hh"
@@ -52,6 +56,7 @@
 #include "debug/RubyCacheTrace.hh"
 #include "debug/RubySystem.hh"
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/system/DMASequencer.hh"
 #include "mem/ruby/system/Sequencer.hh"
@@ -78,7 +83,7 @@ bool RubySystem::m_cooldown_enabled = false;
 
 RubySystem::RubySystem(const Params &p)
     : ClockedObject(p), m_access_backing_store(p.access_backing_store),
-      m_cache_recorder(NULL)
+      m_warmup_requests(p.warmup_requests), m_cache_recorder(NULL)
 {
     m_randomization = p.randomization;
 
@@ -376,6 +381,223 @@ RubySystem::readCompressedTrace(std::string filename, uint8_t *&raw_data,
     }
 }
 
+void
+RubySystem::readCacheSnapshot(const std::string &filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        perror("open");
+        fatal("Unable to open cache snapshot %s", filename);
+    }
+
+    gzFile snapshot = gzdopen(fd, "rb");
+    if (snapshot == NULL) {
+        fatal("Insufficient memory to allocate compression state for %s\n",
+              filename);
+    }
+
+    CacheSnapshotHeader header;
+    if (gzread(snapshot, &header, sizeof(header)) != sizeof(header) ||
+        memcmp(header.magic, CacheSnapshotHeader::Magic,
+               sizeof(header.magic)) != 0) {
+        fatal("%s is not a cache snapshot\n", filename);
+    }
+    fatal_if(header.version != CacheSnapshotHeader::Version,
+             "Unsupported version %d of cache snapshot %s\n",
+             header.version, filename);
+    fatal_if(!isPowerOf2(header.blockSize) ||
+             header.blockSize < getBlockSizeBytes(),
+             "Cache snapshot %s has a block size of %d bytes, it must be a "
+             "power of two no smaller than the Ruby block size\n",
+             filename, header.blockSize);
+
+    // Snapshot sequencer numbers only count the controllers with a
+    // sequencer, as other controllers cannot issue requests.
+    std::vector<int> seq_cntrls;
+    for (int cntrl = 0; cntrl < m_abs_cntrl_vec.size(); cntrl++) {
+        if (m_abs_cntrl_vec[cntrl]->getCPUSequencer())
+            seq_cntrls.push_back(cntrl);
+    }
+
+    // Split the records into Ruby blocks and work out the state every
+    // line is left in once all of its requests are done: a store leaves
+    // a single writable copy, and a load or fetch adds a shared copy,
+    // downgrading the copy of any other writer.
+    struct SnapshotLine
+    {
+        NetDest holders;
+        NetDest fetchers;
+        bool writable = false;
+        uint64_t lastUse = 0;
+        bool replay = false;
+    };
+    struct SnapshotRequest
+    {
+        int cntrl;
+        Addr addr;
+        RubyRequestType type;
+    };
+    std::vector<SnapshotRequest> requests;
+    std::unordered_map<Addr, SnapshotLine> lines;
+
+    for (uint64_t i = 0; i < header.numRecords; i++) {
+        CacheSnapshotRecord record;
+        if (gzread(snapshot, &record, sizeof(record)) != sizeof(record))
+            fatal("Cache snapshot %s is truncated\n", filename);
+        fatal_if(record.sequencer >= seq_cntrls.size(),
+                 "Cache snapshot %s uses sequencer %d but only %d exist\n",
+                 filename, record.sequencer, seq_cntrls.size());
+
+        SnapshotRequest req;
+        req.cntrl = seq_cntrls[record.sequencer];
+        switch (record.type) {
+          case CacheSnapshotRecord::Load:
+            req.type = RubyRequestType_LD;
+            break;
+          case CacheSnapshotRecord::IFetch:
+            req.type = RubyRequestType_IFETCH;
+            break;
+          case CacheSnapshotRecord::Store:
+            req.type = RubyRequestType_ST;
+            break;
+          default:
+            fatal("Unknown request type %d in cache snapshot %s\n",
+                  record.type, filename);
+        }
+
+        MachineID requestor = m_abs_cntrl_vec[req.cntrl]->getMachineID();
+        Addr base = record.addr & ~Addr(header.blockSize - 1);
+        for (uint64_t offset = 0; offset < header.blockSize;
+             offset += getBlockSizeBytes()) {
+            req.addr = base + offset;
+            SnapshotLine &line = lines[req.addr];
+            line.lastUse = requests.size();
+            requests.push_back(req);
+
+            if (req.type == RubyRequestType_ST) {
+                line.holders.clear();
+                line.fetchers.clear();
+                line.holders.add(requestor);
+                line.writable = true;
+                continue;
+            }
+            if (line.writable && (!line.holders.isElement(requestor) ||
+                                  req.type == RubyRequestType_IFETCH)) {
+                line.writable = false;
+            }
+            line.holders.add(requestor);
+            if (req.type == RubyRequestType_IFETCH)
+                line.fetchers.add(requestor);
+            else
+                line.fetchers.remove(requestor);
+        }
+    }
+
+    if (gzclose(snapshot)) {
+        fatal("Failed to close cache snapshot '%s'\n", filename);
+    }
+
+    DPRINTF(RubyCacheTrace, "Read %d records for %d lines from cache "
+            "snapshot %s\n", header.numRecords, lines.size(), filename);
+
+    // Each line is read from memory once, before any cache holds it.
+    auto read_line = [this, &filename](Addr addr, uint8_t *data) {
+        RequestPtr req = std::make_shared<Request>(
+            addr, getBlockSizeBytes(), 0, Request::funcRequestorId);
+        Packet pkt(req, MemCmd::ReadReq);
+        pkt.dataStatic(data);
+        fatal_if(!functionalRead(&pkt),
+                 "Unable to read %#x for cache snapshot %s\n",
+                 addr, filename);
+    };
+
+    // Install the lines least recently used first, so the replacement
+    // state of the caches follows the snapshot. A line goes straight
+    // into CacheMemory and the directory entries when every controller
+    // can take it. The rest, including all lines of protocols without
+    // warmup support, are replayed through the sequencers.
+    std::vector<std::pair<uint64_t, Addr>> order;
+    order.reserve(lines.size());
+    for (const auto &line : lines)
+        order.emplace_back(line.second.lastUse, line.first);
+    std::sort(order.begin(), order.end());
+
+    uint64_t installed = 0;
+    std::vector<uint8_t> buffer(getBlockSizeBytes());
+    for (const auto &entry : order) {
+        Addr addr = entry.second;
+        SnapshotLine &line = lines[addr];
+        bool can_install = true;
+        for (auto *cntrl : m_abs_cntrl_vec) {
+            if (!cntrl->warmupCanInstall(addr, line.holders, line.fetchers,
+                                         line.writable)) {
+                can_install = false;
+                break;
+            }
+        }
+        if (!can_install) {
+            line.replay = true;
+            continue;
+        }
+
+        read_line(addr, buffer.data());
+        DataBlock data;
+        data.setData(buffer.data(), 0, getBlockSizeBytes());
+        for (auto *cntrl : m_abs_cntrl_vec) {
+            cntrl->warmupInstall(addr, data, line.holders, line.fetchers,
+                                 line.writable);
+        }
+        installed++;
+    }
+
+    DPRINTF(RubyCacheTrace, "Installed %d lines from cache snapshot %s, "
+            "replaying %d\n", installed, filename,
+            lines.size() - installed);
+
+    if (installed == lines.size())
+        return;
+
+    // Replayed requests go through the protocol, so they carry the line's
+    // current contents: stores write it back unchanged and only the
+    // coherence state of the line changes.
+    uint64_t record_size = sizeof(TraceRecord) + getBlockSizeBytes();
+    uint64_t num_replayed = 0;
+    for (const auto &req : requests) {
+        if (lines[req.addr].replay)
+            num_replayed++;
+    }
+    uint64_t trace_size = num_replayed * record_size;
+    uint8_t *trace = new uint8_t[trace_size];
+
+    std::unordered_map<Addr, uint8_t *> line_data;
+    uint8_t *next = trace;
+    for (uint64_t i = 0; i < requests.size(); i++) {
+        const SnapshotRequest &req = requests[i];
+        if (!lines[req.addr].replay)
+            continue;
+
+        TraceRecord *rec = (TraceRecord *)next;
+        rec->m_cntrl_id = req.cntrl;
+        rec->m_time = i;
+        rec->m_data_address = req.addr;
+        rec->m_pc_address = 0;
+        rec->m_type = req.type;
+        auto it = line_data.find(req.addr);
+        if (it == line_data.end()) {
+            read_line(req.addr, rec->m_data);
+            line_data[req.addr] = rec->m_data;
+        } else {
+            memcpy(rec->m_data, it->second, getBlockSizeBytes());
+        }
+        next += record_size;
+    }
+
+    m_warmup_enabled = true;
+    m_systems_to_warmup++;
+
+    makeCacheRecorder(trace, trace_size, getBlockSizeBytes());
+}
+
 void
 RubySystem::unserialize(CheckpointIn &cp)
 {
@@ -428,6 +650,12 @@ RubySystem::startup()
     // simulation starts. And then one also needs to hope that the time
     // Ruby finishes restoring the state is less than the time when the
     // state was checkpointed.
+    //
+    // Without a checkpoint the caches can be warmed up the same way from a
+    // cache snapshot.
+
+    if (!m_cache_recorder && !params().cache_snapshot.empty())
+        readCacheSnapshot(params().cache_snapshot);
 
     if (m_warmup_enabled) {
         DPRINTF(RubyCacheTrace, "Starting ruby cache warmup\n");
@@ -464,7 +692,10 @@ void
 RubySystem::processRubyEvent()
 {
     if (getWarmupEnabled()) {
-        m_cache_recorder->enqueueNextFetchRequest();
+        // Every completed request issues the next one, so this sets how
+        // many requests are in flight for the rest of the warmup.
+        for (unsigned i = 0; i < m_warmup_requests; i++)
+            m_cache_recorder->enqueueNextFetchRequest();
     } else if (getCooldownEnabled()) {
         m_cache_recorder->enqueueNextFlushRequest();
     }
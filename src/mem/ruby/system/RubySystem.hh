@@ -125,6 +125,8 @@ class RubySystem : public ClockedObject
                            uint64_t cache_trace_size,
                            uint64_t block_size_bytes);
 
+    void readCacheSnapshot(const std::string &filename);
+
     static void readCompressedTrace(std::string filename,
                                     uint8_t *&raw_data,
                                     uint64_t &uncompressed_trace_size);
@@ -144,6 +146,7 @@ class RubySystem : public ClockedObject
     static bool m_cooldown_enabled;
     memory::SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
+    const unsigned m_warmup_requests;
 
     //std::vector<Network *> m_networks;
     std::vector<std::unique_ptr<Network>> m_networks;
@@ -49,6 +49,13 @@ class RubySystem(ClockedObject):
     access_backing_store = Param.Bool(False, "Use phys_mem as the functional \
         store and only use ruby for timing.")
 
+    cache_snapshot = Param.String("", "Cache snapshot used to warm up the \
+        caches at startup when not restoring from a checkpoint (see \
+        util/ruby_cache_snapshot.py)")
+    warmup_requests = Param.Unsigned(1, "Number of cache warmup requests \
+        in flight. Overlapping requests makes warmup faster but lines are \
+        no longer installed in strict trace order.")
+
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
@@ -66,7 +66,8 @@ namespace ruby
 {
 
 Sequencer::Sequencer(const Params &p)
-    : RubyPort(p), m_IncompleteTimes(MachineType_NUM),
+    : RubyPort(p), m_RequestTable(p.max_outstanding_requests),
+      m_IncompleteTimes(MachineType_NUM),
       deadlockCheckEvent([this]{ wakeup(); }, "Sequencer deadlock check")
 {
     m_outstanding_count = 0;
@@ -310,7 +311,7 @@ Sequencer::insertRequest(PacketPtr pkt, RubyRequestType primary_type,
 
     Addr line_addr = makeLineAddress(pkt->getAddr());
     // Check if there is any outstanding request for the same cache line.
-    auto &seq_req_list = m_RequestTable[line_addr];
+    auto seq_req_list = m_RequestTable[line_addr];
     // Create a default entry
     seq_req_list.emplace_back(pkt, primary_type,
         secondary_type, curCycle());
@@ -417,8 +418,8 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
     // to this cache line when response for the write comes back
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.count(address));
+    auto seq_req_list = m_RequestTable[address];
 
     // Perform hitCallback on every cpu request made to this cache block while
     // ruby request was outstanding. Since only 1 ruby request was made,
@@ -499,11 +500,6 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
         }
         seq_req_list.pop_front();
     }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
-    }
 }
 
 void
@@ -518,8 +514,8 @@ Sequencer::readCallback(Addr address, DataBlock& data,
     // or end of the corresponding list.
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.count(address));
+    auto seq_req_list = m_RequestTable[address];
 
     // Perform hitCallback on every cpu request made to this cache block while
     // ruby request was outstanding. Since only 1 ruby request was made,
@@ -554,11 +550,6 @@ Sequencer::readCallback(Addr address, DataBlock& data,
         ruby_request = false;
         seq_req_list.pop_front();
     }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
-    }
 }
 
 void
@@ -813,9 +804,9 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
     m_mandatory_q_ptr->enqueue(msg, clockEdge(), latency);
 }
 
-template <class KEY, class VALUE>
+template <class VALUE>
 std::ostream &
-operator<<(std::ostream &out, const std::unordered_map<KEY, VALUE> &map)
+operator<<(std::ostream &out, const LineRequestTable<VALUE> &map)
 {
     for (const auto &table_entry : map) {
         out << "[ " << table_entry.first << " =";
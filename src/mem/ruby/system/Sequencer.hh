@@ -42,14 +42,13 @@
 #define __MEM_RUBY_SYSTEM_SEQUENCER_HH__
 
 #include <iostream>
-#include <list>
-#include <unordered_map>
 
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/protocol/MachineType.hh"
 #include "mem/ruby/protocol/RubyRequestType.hh"
 #include "mem/ruby/protocol/SequencerRequestType.hh"
 #include "mem/ruby/structures/CacheMemory.hh"
+#include "mem/ruby/structures/LineRequestTable.hh"
 #include "mem/ruby/system/RubyPort.hh"
 #include "params/RubySequencer.hh"
 
@@ -214,7 +213,7 @@ class Sequencer : public RubyPort
 
   protected:
     // RequestTable contains both read and write requests, handles aliasing
-    std::unordered_map<Addr, std::list<SequencerRequest>> m_RequestTable;
+    LineRequestTable<SequencerRequest> m_RequestTable;
 
     Cycles m_deadlock_threshold;
 
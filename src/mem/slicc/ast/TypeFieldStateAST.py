@@ -54,6 +54,7 @@ class TypeFieldStateAST(TypeFieldAST):
         if not machine:
             self.error("State declaration not part of a machine.")
         s = State(self.symtab, self.field_id, self.location, self.pairs)
+        s.permission = self.perm_ast.value
         machine.addState(s)
 
         type.statePermPairAdd(s, self.perm_ast.value)
@@ -207,6 +207,14 @@ class StateMachine(Symbol):
                 action.warning(error_msg)
         self.table = table
 
+    def isTransientState(self, state):
+        '''States with a busy access permission are transient. Transient
+        states that keep (part of) the data accessible, e.g., a shared
+        line waiting for an upgrade, are declared with transient="yes".'''
+        if "transient" in state:
+            return state["transient"] == "yes"
+        return state.permission in ("Busy", "Backing_Store_Busy")
+
     # determine the port->msg buffer mappings
     def getBufferMaps(self, ident):
         msg_bufs = []
@@ -226,7 +234,6 @@ class StateMachine(Symbol):
         self.printControllerPython(path)
         self.printControllerHH(path)
         self.printControllerCC(path, includes)
-        self.printCSwitch(path)
         self.printCWakeup(path, includes)
 
     def printControllerPython(self, path):
@@ -517,7 +524,11 @@ void unset_tbe(${{self.TBEType.c_ident}}*& m_tbe_ptr);
         code(boolvec_include)
         code(base_include)
 
-        for f in self.debug_flags:
+        code('''
+#include "base/logging.hh"
+#include "base/trace.hh"
+''')
+        for f in sorted(set(self.debug_flags) | {"ProtocolTrace"}):
             code('#include "debug/${{f}}.hh"')
         code('''
 #include "mem/ruby/network/Network.hh"
@@ -880,6 +891,18 @@ $c_ident::regStats()
         r->flags(statistics::nozero);
     }
 
+    for (${ident}_State state = ${ident}_State_FIRST;
+         state < ${ident}_State_NUM; ++state) {
+        std::string stat_name =
+            "transientStateLatHist." + ${ident}_State_to_string(state);
+        statistics::Histogram* t =
+            new statistics::Histogram(&stats, stat_name.c_str());
+        stats.transientStateLatHist.push_back(t);
+        t->init(5);
+        t->flags(statistics::pdf | statistics::total |
+                 statistics::oneline | statistics::nozero);
+    }
+
     for (${ident}_Event event = ${ident}_Event_FIRST;
                  event < ${ident}_Event_NUM; ++event) {
         std::string stat_name = "inTransLatHist." +
@@ -1151,6 +1174,12 @@ $c_ident::${{action.ident}}(Addr addr)
         for func in self.functions:
             code(func.generateCode())
 
+        # The transition switch is emitted in the same translation unit as
+        # the actions and the machine's internal functions (getState,
+        # setState, ...), so the compiler can inline them into the dispatch
+        # instead of going through an out-of-line call per action.
+        self.printCSwitch(code)
+
         # Function for functional writes to messages buffered in the controller
         code('''
 int
@@ -1358,38 +1387,38 @@ ${ident}_Controller::wakeup()
 
         code.write(path, "%s_Wakeup.cc" % self.ident)
 
-    def printCSwitch(self, path):
-        '''Output switch statement for transition table'''
+    def printCSwitch(self, code):
+        '''Output switch statement for transition table
+
+        The switch is emitted into the controller translation unit so
+        the actions and getState/setState can be inlined into each case.
+        The cache entry and TBE pointers are passed by reference through
+        the actions, so a transition does not look them up again. The
+        switch on HASH_FUN(state, event) is dense and compiles to a jump
+        table. Reordering the cases, e.g. by profile, would therefore
+        not change the dispatch cost, and no such ordering is done.
+        '''
 
-        code = self.symtab.codeFormatter()
         ident = self.ident
 
-        code('''
-// ${ident}: ${{self.short}}
+        # The residency of transient states is profiled in
+        # transientStateLatHist
+        transient = [ "true" if self.isTransientState(state) else "false"
+                      for state in self.states.values() ]
+        transient = ", ".join(transient)
 
-#include <cassert>
+        code('''
+// Transitions
 
-#include "base/logging.hh"
-#include "base/trace.hh"
-#include "debug/ProtocolTrace.hh"
-#include "debug/RubyGenerated.hh"
-#include "mem/ruby/protocol/${ident}_Controller.hh"
-#include "mem/ruby/protocol/${ident}_Event.hh"
-#include "mem/ruby/protocol/${ident}_State.hh"
-#include "mem/ruby/protocol/Types.hh"
-#include "mem/ruby/system/RubySystem.hh"
+static const bool ${ident}_transientState[${ident}_State_NUM] = {
+    $transient
+};
 
 #define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
 
 #define GET_TRANSITION_COMMENT() (${ident}_transitionComment.str())
 #define CLEAR_TRANSITION_COMMENT() (${ident}_transitionComment.str(""))
 
-namespace gem5
-{
-
-namespace ruby
-{
-
 TransitionResult
 ${ident}_Controller::doTransition(${ident}_Event event,
 ''')
@@ -1466,6 +1495,10 @@ if (result == TransitionResult_Valid) {
             code('setAccessPermission(addr, next_state);')
 
         code('''
+    if (next_state != state) {
+        profileStateChange(addr, state, ${ident}_transientState[state],
+                           ${ident}_transientState[next_state]);
+    }
 } else if (result == TransitionResult_ResourceStall) {
     DPRINTFR(ProtocolTrace, "%15s %3s %10s%20s %6s>%-6s %#x %s\\n",
              curTick(), m_version, "${ident}",
@@ -1618,10 +1651,10 @@ if (!checkResourceAvailable(%s_RequestType_%s, addr)) {
     return TransitionResult_Valid;
 }
 
-} // namespace ruby
-} // namespace gem5
+#undef HASH_FUN
+#undef GET_TRANSITION_COMMENT
+#undef CLEAR_TRANSITION_COMMENT
 ''')
-        code.write(path, "%s_Transitions.cc" % self.ident)
 
 
     # **************************
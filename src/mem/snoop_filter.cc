@@ -67,6 +67,7 @@ std::pair<SnoopFilter::SnoopList, Cycles>
 SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
                            cpu_side_port)
 {
+    checkQueue(__func__);
     DPRINTF(SnoopFilter, "%s: src %s packet %s\n", __func__,
             cpu_side_port.name(), cpkt->print());
 
@@ -159,6 +160,7 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 void
 SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
 {
+    checkQueue(__func__);
     if (reqLookupResult.it != cachedLocations.end()) {
         // since we rely on the caller, do a basic check to ensure
         // that finishRequest is being called following lookupRequest
@@ -185,6 +187,7 @@ SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
 std::pair<SnoopFilter::SnoopList, Cycles>
 SnoopFilter::lookupSnoop(const Packet* cpkt)
 {
+    checkQueue(__func__);
     DPRINTF(SnoopFilter, "%s: packet %s\n", __func__, cpkt->print());
 
     assert(cpkt->isRequest());
@@ -247,6 +250,7 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
                                  const ResponsePort& rsp_port,
                                  const ResponsePort& req_port)
 {
+    checkQueue(__func__);
     DPRINTF(SnoopFilter, "%s: rsp %s req %s packet %s\n",
             __func__, rsp_port.name(), req_port.name(), cpkt->print());
 
@@ -303,6 +307,7 @@ void
 SnoopFilter::updateSnoopForward(const Packet* cpkt,
         const ResponsePort& rsp_port, const RequestPort& req_port)
 {
+    checkQueue(__func__);
     DPRINTF(SnoopFilter, "%s: rsp %s req %s packet %s\n",
             __func__, rsp_port.name(), req_port.name(), cpkt->print());
 
@@ -340,6 +345,7 @@ void
 SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
                             cpu_side_port)
 {
+    checkQueue(__func__);
     DPRINTF(SnoopFilter, "%s: src %s packet %s\n",
             __func__, cpu_side_port.name(), cpkt->print());
 
@@ -263,6 +263,17 @@ class SnoopFilter : public SimObject
      */
     void eraseIfNullEntry(SnoopFilterCache::iterator& sf_it);
 
+    /**
+     * The filter is owned by its crossbar and is not thread-safe,
+     * every update must come from the crossbar's event queue.
+     */
+    void
+    checkQueue(const char *func) const
+    {
+        panic_if(!onOwnQueue(), "%s: %s called from another event queue\n",
+                 name(), func);
+    }
+
     /** Simple hash set of cached addresses. */
     SnoopFilterCache cachedLocations;
 
@@ -42,6 +42,7 @@
 using namespace google::protobuf;
 
 ProtoOutputStream::ProtoOutputStream(const std::string& filename) :
+    writing(false), closing(false),
     fileStream(filename.c_str(),
             std::ios::out | std::ios::binary | std::ios::trunc),
     wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL)
@@ -67,10 +68,21 @@ ProtoOutputStream::ProtoOutputStream(const std::string& filename) :
 
     // Note that each type of stream (packet, instruction etc) should
     // add its own header and perform the appropriate checks
+
+    batch.reserve(batchSize);
+    writer = std::thread([this]() { writeBatches(); });
 }
 
 ProtoOutputStream::~ProtoOutputStream()
 {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closing = true;
+    }
+    cv.notify_all();
+    writer.join();
+
     // As the compression is optional, see if the stream exists
     if (gzipStream != NULL)
         delete gzipStream;
@@ -81,21 +93,102 @@ ProtoOutputStream::~ProtoOutputStream()
 void
 ProtoOutputStream::write(const Message& msg)
 {
-    // Due to the byte limit of the coded stream we create it for
-    // every single mesage (based on forum discussions around the size
-    // limitation)
-    io::CodedOutputStream codedStream(zeroCopyStream);
-
-    // Write the size of the message to the stream
+    // Get the size of the message, which also caches the sizes used
+    // when serializing it
 #   if GOOGLE_PROTOBUF_VERSION < 3001000
         auto msg_size = msg.ByteSize();
 #   else
         auto msg_size = msg.ByteSizeLong();
 #   endif
-    codedStream.WriteVarint32(msg_size);
+    const size_t max_size =
+        io::CodedOutputStream::VarintSize32(msg_size) + msg_size;
+
+    if (!batch.empty() && batch.size() + max_size > batch.capacity())
+        submitBatch();
+
+    // Serialize the size of the message followed by the message itself
+    // at the end of the batch
+    const size_t start = batch.size();
+    batch.resize(start + max_size);
+    uint8_t *target = batch.data() + start;
+    target = io::CodedOutputStream::WriteVarint32ToArray(msg_size, target);
+    target = msg.SerializeWithCachedSizesToArray(target);
+    assert(target == batch.data() + batch.size());
+}
+
+void
+ProtoOutputStream::submitBatch()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    // Apply backpressure if the writer does not keep up
+    cv.wait(lock, [this]() {
+        return pendingBatches.size() < maxPendingBatches;
+    });
+    pendingBatches.push_back(std::move(batch));
+
+    if (freeBatches.empty()) {
+        batch = Batch();
+        batch.reserve(batchSize);
+    } else {
+        batch = std::move(freeBatches.back());
+        freeBatches.pop_back();
+        batch.clear();
+    }
 
-    // Write the message itself to the stream
-    msg.SerializeWithCachedSizes(&codedStream);
+    lock.unlock();
+    cv.notify_all();
+}
+
+void
+ProtoOutputStream::writeBatches()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        cv.wait(lock, [this]() {
+            return closing || !pendingBatches.empty();
+        });
+        if (pendingBatches.empty())
+            return;
+
+        Batch pending = std::move(pendingBatches.front());
+        pendingBatches.pop_front();
+        writing = true;
+        lock.unlock();
+
+        // Due to the byte limit of the coded stream we create it for
+        // every batch, which are much smaller than the limit
+        {
+            io::CodedOutputStream codedStream(zeroCopyStream);
+            codedStream.WriteRaw(pending.data(), pending.size());
+        }
+
+        lock.lock();
+        writing = false;
+        // Only keep batches of the regular size
+        if (pending.capacity() <= batchSize)
+            freeBatches.push_back(std::move(pending));
+        cv.notify_all();
+    }
+}
+
+void
+ProtoOutputStream::flush()
+{
+    if (!batch.empty())
+        submitBatch();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() {
+        return pendingBatches.empty() && !writing;
+    });
+}
+
+gem5::DrainState
+ProtoOutputStream::drain()
+{
+    flush();
+    return gem5::DrainState::Drained;
 }
 
 ProtoInputStream::ProtoInputStream(const std::string& filename) :
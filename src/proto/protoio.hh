@@ -49,7 +49,15 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/message.h>
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sim/drain.hh"
 
 /**
  * A ProtoStream provides the shared functionality of the input and
@@ -86,8 +94,15 @@ class ProtoStream
  * basis to avoid having to deal with huge data structures. The latter
  * is made possible by encoding the length of each message in the
  * stream.
+ *
+ * Messages are serialized into large batches, which a background
+ * thread compresses and writes to the file, so that the simulation
+ * only pays for the serialization. At most maxPendingBatches batches
+ * wait for the writer, after which writing a message blocks until one
+ * is written. The stream is flushed when the simulator drains, and
+ * when it is destroyed.
  */
-class ProtoOutputStream : public ProtoStream
+class ProtoOutputStream : public ProtoStream, public gem5::Drainable
 {
 
   public:
@@ -114,8 +129,57 @@ class ProtoOutputStream : public ProtoStream
      */
     void write(const google::protobuf::Message& msg);
 
+    /**
+     * Wait until all the messages written so far are handed to the
+     * underlying file stream.
+     */
+    void flush();
+
+    gem5::DrainState drain() override;
+
   private:
 
+    typedef std::vector<uint8_t> Batch;
+
+    /// Size of the batches, larger messages get a batch of their own
+    static const size_t batchSize = 1 << 20;
+
+    /// Number of batches waiting for the writer before writes block
+    static const size_t maxPendingBatches = 4;
+
+    /**
+     * Hand the current batch to the writer thread, and replace it
+     * with an empty one, waiting for the writer if needed.
+     */
+    void submitBatch();
+
+    /**
+     * Main loop of the writer thread, compressing and writing the
+     * batches in order.
+     */
+    void writeBatches();
+
+    /// Batch being filled by the simulation
+    Batch batch;
+
+    /// Protects the state shared with the writer thread
+    std::mutex mutex;
+
+    /// Signals changes of the state shared with the writer thread
+    std::condition_variable cv;
+
+    /// Batches waiting to be written, in order
+    std::deque<Batch> pendingBatches;
+
+    /// Written batches, kept to be filled again
+    std::vector<Batch> freeBatches;
+
+    /// Whether the writer thread is writing a batch
+    bool writing;
+
+    /// Whether the writer thread should exit once it is done
+    bool closing;
+
     /// Underlying file output stream
     std::ofstream fileStream;
 
@@ -128,6 +192,9 @@ class ProtoOutputStream : public ProtoStream
     /// Top-level zero-copy stream, either with compression or not
     google::protobuf::io::ZeroCopyOutputStream* zeroCopyStream;
 
+    /// Background thread, the only user of the streams once started
+    std::thread writer;
+
 };
 
 /**
@@ -201,4 +268,186 @@ class ProtoInputStream : public ProtoStream
 
 };
 
+/**
+ * A ProtoPrefetchStream reads the messages of a ProtoInputStream ahead
+ * of their use, in batches parsed by a background thread, so that the
+ * reader only pays for handing over the parsed messages. The input
+ * stream must not be used directly while the prefetch stream reads it,
+ * and the headers of the trace must thus be read beforehand.
+ */
+template <typename Msg>
+class ProtoPrefetchStream
+{
+
+  public:
+
+    /**
+     * Create a prefetch stream, which starts reading the input stream
+     * on the first read.
+     *
+     * @param stream Input stream to read the messages from
+     * @param batch_size Number of messages parsed in a batch
+     */
+    ProtoPrefetchStream(ProtoInputStream& stream, size_t batch_size=4096)
+        : stream(stream), batchSize(batch_size), next(0), started(false),
+          endOfStream(false), stopping(false)
+    {}
+
+    ~ProtoPrefetchStream() { stop(); }
+
+    /**
+     * Read a message from the stream.
+     *
+     * @param msg Message read from the stream
+     * @param return True if a message was read, false at the end
+     */
+    bool
+    read(Msg& msg)
+    {
+        if (!started)
+            start();
+
+        if (next == batch.size()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!batch.empty())
+                freeBatches.push_back(std::move(batch));
+            cv.wait(lock, [this]() {
+                return !fullBatches.empty() || endOfStream;
+            });
+            if (fullBatches.empty())
+                return false;
+            batch = std::move(fullBatches.front());
+            fullBatches.pop_front();
+            next = 0;
+            lock.unlock();
+            cv.notify_all();
+        }
+
+        msg.Swap(&batch[next++]);
+        return true;
+    }
+
+    /**
+     * Stop prefetching and reset the input stream such that it can be
+     * read once again.
+     */
+    void
+    reset()
+    {
+        stop();
+        stream.reset();
+    }
+
+  private:
+
+    typedef std::vector<Msg> Batch;
+
+    /// Number of parsed batches waiting for the reader
+    static const size_t maxPendingBatches = 2;
+
+    void
+    start()
+    {
+        started = true;
+        endOfStream = false;
+        stopping = false;
+        prefetcher = std::thread([this]() { prefetch(); });
+    }
+
+    void
+    stop()
+    {
+        if (!started)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        prefetcher.join();
+
+        started = false;
+        fullBatches.clear();
+        batch.clear();
+        next = 0;
+    }
+
+    /// Main loop of the prefetch thread
+    void
+    prefetch()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [this]() {
+                return stopping || fullBatches.size() < maxPendingBatches;
+            });
+            if (stopping)
+                return;
+
+            Batch parsed;
+            if (!freeBatches.empty()) {
+                parsed = std::move(freeBatches.back());
+                freeBatches.pop_back();
+            }
+            lock.unlock();
+
+            // Parse the batch without holding the lock, the messages
+            // of a recycled batch are reused
+            parsed.resize(batchSize);
+            size_t num_parsed = 0;
+            while (num_parsed < batchSize &&
+                   stream.read(parsed[num_parsed]))
+                ++num_parsed;
+            const bool end = num_parsed < batchSize;
+            parsed.resize(num_parsed);
+
+            lock.lock();
+            if (!parsed.empty())
+                fullBatches.push_back(std::move(parsed));
+            cv.notify_all();
+            if (end) {
+                endOfStream = true;
+                cv.notify_all();
+                return;
+            }
+        }
+    }
+
+    /// Input stream, only read by the prefetch thread once started
+    ProtoInputStream& stream;
+
+    /// Number of messages parsed in a batch
+    const size_t batchSize;
+
+    /// Batch being read, and the index of its next message
+    Batch batch;
+    size_t next;
+
+    /// Whether the prefetch thread was started
+    bool started;
+
+    /// Protects the state shared with the prefetch thread
+    std::mutex mutex;
+
+    /// Signals changes of the state shared with the prefetch thread
+    std::condition_variable cv;
+
+    /// Parsed batches waiting to be read, in order
+    std::deque<Batch> fullBatches;
+
+    /// Read batches, kept to be filled again
+    std::vector<Batch> freeBatches;
+
+    /// Whether the prefetch thread reached the end of the stream
+    bool endOfStream;
+
+    /// Whether the prefetch thread should exit
+    bool stopping;
+
+    /// Background thread parsing the messages
+    std::thread prefetcher;
+
+};
+
 #endif //__PROTO_PROTOIO_HH
@@ -149,6 +149,16 @@ def parse_options():
     option("--remote-gdb-port", type='int', default=7000,
         help="Remote gdb base port (set to 0 to disable listening)")
 
+    # Profiling options
+    group("Profiling Options")
+    option("--event-profile", metavar="N", type='int', default=0,
+        help="Time on average one in N events on the host and report " \
+             "the time spent per SimObject at exit (0 to disable) " \
+             "[Default: %default]")
+    option("--event-timeline", metavar="N", type='int', default=100000,
+        help="Keep up to N timed events per event queue for the event " \
+             "profile timeline [Default: %default]")
+
     # Help options
     group("Help Options")
     option("--list-sim-objects", action='store_true', default=False,
@@ -423,6 +433,9 @@ def main(*args):
         _check_tracing()
         trace.ignore(ignore)
 
+    if options.event_profile:
+        event.enableProfile(options.event_profile, options.event_timeline)
+
     sys.argv = arguments
     sys.path = [ os.path.dirname(sys.argv[0]) ] + sys.path
 
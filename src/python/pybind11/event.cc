@@ -44,6 +44,7 @@
 #include "pybind11/stl.h"
 
 #include "base/logging.hh"
+#include "sim/event_profile.hh"
 #include "sim/eventq.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
@@ -113,6 +114,8 @@ pybind_init_event(py::module_ &m_native)
     m.def("setEventQueue", [](EventQueue *q) { return curEventQueue(q); });
     m.def("getEventQueue", &getEventQueue,
           py::return_value_policy::reference);
+    m.def("enableProfile", &EventProfile::enable,
+          py::arg("period"), py::arg("max_timeline"));
 
     py::class_<EventQueue>(m, "EventQueue")
         .def("name",  [](EventQueue *eq) { return eq->name(); })
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_profile.hh"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_exit.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Profiles of all event queues, in the order they were created. */
+std::mutex profilesMutex;
+std::vector<std::unique_ptr<EventProfile>> profiles;
+
+bool
+isSimObject(const std::string &name)
+{
+    return SimObject::find(name.c_str());
+}
+
+std::string
+jsonEscape(const std::string &str)
+{
+    std::string escaped;
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        if ((unsigned char)c < 0x20)
+            escaped += csprintf("\\u%04x", (int)c);
+        else
+            escaped += c;
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+EventProfile::Clock::time_point EventProfile::startTime;
+size_t EventProfile::maxTimeline = 0;
+
+EventProfile::EventProfile(const EventQueue *_queue, unsigned _id)
+    : queue(_queue), id(_id), stride(_id)
+{
+    timeline.reserve(std::min<size_t>(maxTimeline, 1 << 16));
+}
+
+void
+EventProfile::enable(unsigned period, size_t max_timeline)
+{
+    fatal_if(eventProfilePeriod, "The event profile is already enabled.");
+    if (!period)
+        return;
+    fatal_if(period > (1U << 31), "The event profile period must be at "
+             "most 2^31.");
+
+    maxTimeline = max_timeline;
+    startTime = Clock::now();
+    eventProfilePeriod = period;
+
+    registerExitCallback([]() { dump(); });
+}
+
+EventProfile *
+EventProfile::get(const EventQueue *queue)
+{
+    std::lock_guard<std::mutex> lock(profilesMutex);
+    profiles.emplace_back(new EventProfile(queue, profiles.size()));
+    return profiles.back().get();
+}
+
+uint32_t
+EventProfile::nextCountdown()
+{
+    return stride.next(eventProfilePeriod);
+}
+
+void
+EventProfile::process(Event *event)
+{
+    // Events that are not given a name are told apart by type instead,
+    // rather than by instance.
+    std::string name = event->name();
+    if (name.compare(0, 6, "Event_") == 0)
+        name = event->description();
+
+    auto it = eventIds.find(name);
+    if (it == eventIds.end()) {
+        it = eventIds.emplace(name, events.size()).first;
+        events.emplace_back();
+        events.back().name = name;
+    }
+
+    const Tick when = event->when();
+    const Clock::time_point start = Clock::now();
+    event->process();
+    const Clock::duration duration = Clock::now() - start;
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    const uint64_t duration_ns = duration_cast<nanoseconds>(duration).count();
+
+    event_profile::Stats &stats = events[it->second];
+    stats.samples++;
+    stats.hostNs += duration_ns;
+
+    if (timeline.size() < maxTimeline) {
+        const uint64_t start_ns =
+            duration_cast<nanoseconds>(start - startTime).count();
+        timeline.push_back(
+            TimelineEntry{it->second, when, start_ns, duration_ns});
+    }
+}
+
+void
+EventProfile::dumpReport(std::ostream &os)
+{
+    std::lock_guard<std::mutex> lock(profilesMutex);
+
+    // Merge the queues
+    std::map<std::string, event_profile::Stats> by_event;
+    for (const auto &profile : profiles) {
+        for (const event_profile::Stats &stats : profile->events) {
+            event_profile::Stats &event = by_event[stats.name];
+            event.name = stats.name;
+            event.samples += stats.samples;
+            event.hostNs += stats.hostNs;
+        }
+    }
+
+    event_profile::writeReport(os, eventProfilePeriod, by_event,
+                               isSimObject);
+}
+
+void
+EventProfile::dumpTimeline(std::ostream &os)
+{
+    std::lock_guard<std::mutex> lock(profilesMutex);
+
+    ccprintf(os, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    bool first = true;
+    for (const auto &profile : profiles) {
+        ccprintf(os, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                 "\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                 first ? "" : ",\n", profile->id,
+                 jsonEscape(profile->queue->name()));
+        first = false;
+
+        std::vector<std::string> names;
+        std::vector<std::string> owners;
+        for (const event_profile::Stats &stats : profile->events) {
+            names.push_back(jsonEscape(stats.name));
+            owners.push_back(jsonEscape(
+                event_profile::ownerOf(stats.name, isSimObject)));
+        }
+
+        for (const TimelineEntry &entry : profile->timeline) {
+            ccprintf(os, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+                     "\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,"
+                     "\"args\":{\"tick\":%d}}",
+                     names[entry.event], owners[entry.event], profile->id,
+                     entry.startNs / 1e3, entry.durationNs / 1e3,
+                     entry.when);
+        }
+    }
+    ccprintf(os, "\n]}\n");
+}
+
+void
+EventProfile::dump()
+{
+    OutputStream *report = simout.create("event_profile.txt");
+    dumpReport(*report->stream());
+    simout.close(report);
+
+    OutputStream *timeline = simout.create("event_timeline.json");
+    dumpTimeline(*timeline->stream());
+    simout.close(timeline);
+}
+
+} // namespace gem5
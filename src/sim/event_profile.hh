@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_PROFILE_HH__
+#define __SIM_EVENT_PROFILE_HH__
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+#include "sim/event_profile_report.hh"
+
+namespace gem5
+{
+
+class Event;
+class EventQueue;
+
+/**
+ * Host time spent by one event queue in the events it services, as
+ * sampled by the event profile. Only the thread servicing the queue
+ * touches it, so no locking is needed.
+ *
+ * When the profile is enabled, on average one in eventProfilePeriod
+ * events the queue services is timed with the host's monotonic clock
+ * and charged to the name of the event, at a jittered stride (see
+ * event_profile::Stride). At exit, the samples of all queues are
+ * scaled by the period and attributed to the SimObject that owns each
+ * event, found by stripping components off the event name, to give a
+ * report sorted by host time. The individual samples are also written
+ * as a Chrome trace event timeline, which Perfetto can open.
+ */
+class EventProfile
+{
+  public:
+    /**
+     * Turn the profile on for all event queues.
+     *
+     * @param period Time one in this many events.
+     * @param max_timeline Samples kept for the timeline of each queue.
+     */
+    static void enable(unsigned period, size_t max_timeline);
+
+    /** Get the profile of an event queue, creating it if needed. */
+    static EventProfile *get(const EventQueue *queue);
+
+    /** Process an event, timing it. */
+    void process(Event *event);
+
+    /** Draw the number of events to service before the next sample. */
+    uint32_t nextCountdown();
+
+    /** Write the per SimObject and per event report. */
+    static void dumpReport(std::ostream &os);
+
+    /** Write the samples as Chrome trace events. */
+    static void dumpTimeline(std::ostream &os);
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    EventProfile(const EventQueue *queue, unsigned id);
+
+    /** Exit callback writing both outputs. */
+    static void dump();
+
+    struct TimelineEntry
+    {
+        uint32_t event;
+        Tick when;
+        /** Host time since the profile was enabled. */
+        uint64_t startNs;
+        uint64_t durationNs;
+    };
+
+    const EventQueue *queue;
+    const unsigned id;
+
+    event_profile::Stride stride;
+
+    std::vector<event_profile::Stats> events;
+    std::unordered_map<std::string, uint32_t> eventIds;
+    std::vector<TimelineEntry> timeline;
+
+    static Clock::time_point startTime;
+    static size_t maxTimeline;
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENT_PROFILE_HH__
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_PROFILE_REPORT_HH__
+#define __SIM_EVENT_PROFILE_REPORT_HH__
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace event_profile
+{
+
+/** Samples and sampled host time of one event or SimObject. */
+struct Stats
+{
+    std::string name;
+    Counter samples = 0;
+    uint64_t hostNs = 0;
+};
+
+/** Tell whether a name is the name of a SimObject. */
+typedef std::function<bool(const std::string &)> IsSimObject;
+
+/**
+ * Distance in events between two samples. A fixed stride would keep
+ * timing the same phase of a schedule with a period that divides it
+ * (e.g. always the same one of a clock's events), so the stride is
+ * drawn uniformly from [1, 2 * period - 1], which keeps one in period
+ * events timed on average. The generator is private so that enabling
+ * the profile doesn't change the random numbers the simulation sees.
+ */
+class Stride
+{
+  public:
+    explicit Stride(uint64_t seed) : state(seed) {}
+
+    uint32_t
+    next(uint32_t period)
+    {
+        // splitmix64
+        uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        z ^= z >> 31;
+        return 1 + z % (2 * (uint64_t)period - 1);
+    }
+
+  private:
+    uint64_t state;
+};
+
+/**
+ * Find the SimObject an event belongs to by stripping components off
+ * the event's name until it names a SimObject.
+ */
+inline std::string
+ownerOf(std::string name, const IsSimObject &is_sim_object)
+{
+    while (!is_sim_object(name)) {
+        const size_t dot = name.rfind('.');
+        if (dot == std::string::npos)
+            return "(not a SimObject)";
+        name.resize(dot);
+    }
+    return name;
+}
+
+/**
+ * Write the report of the events sampled by all queues, one table per
+ * owning SimObject and one per event, sorted by host time. Host time
+ * and event counts are estimated by scaling the samples by the period.
+ */
+inline void
+writeReport(std::ostream &os, uint32_t period,
+            const std::map<std::string, Stats> &by_event,
+            const IsSimObject &is_sim_object)
+{
+    std::map<std::string, Stats> by_owner;
+    Counter total_samples = 0;
+    uint64_t total_ns = 0;
+    for (const auto &event : by_event) {
+        const std::string owner = ownerOf(event.first, is_sim_object);
+        Stats &stats = by_owner[owner];
+        stats.name = owner;
+        stats.samples += event.second.samples;
+        stats.hostNs += event.second.hostNs;
+        total_samples += event.second.samples;
+        total_ns += event.second.hostNs;
+    }
+
+    ccprintf(os, "Event profile: on average one in %d events timed, "
+             "%d samples, %.3f ms of sampled host time\n", period,
+             total_samples, total_ns / 1e6);
+    ccprintf(os, "Estimated host time and event counts are scaled by "
+             "the sampling period\n");
+
+    auto print = [&](const char *title,
+                     const std::map<std::string, Stats> &table) {
+        std::vector<const Stats *> sorted;
+        for (const auto &entry : table)
+            sorted.push_back(&entry.second);
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const Stats *a, const Stats *b) {
+                             return a->hostNs > b->hostNs;
+                         });
+
+        ccprintf(os, "\n%s\n", title);
+        ccprintf(os, "%12s %7s %14s %10s  %s\n", "host ms", "%",
+                 "events", "ns/event", "name");
+        for (const Stats *stats : sorted) {
+            ccprintf(os, "%12.3f %7.2f %14d %10.1f  %s\n",
+                     stats->hostNs * period / 1e6,
+                     total_ns ? 100.0 * stats->hostNs / total_ns : 0.0,
+                     stats->samples * period,
+                     (double)stats->hostNs / stats->samples,
+                     stats->name);
+        }
+    };
+
+    print("Host time per SimObject", by_owner);
+    print("Host time per event", by_event);
+}
+
+} // namespace event_profile
+} // namespace gem5
+
+#endif // __SIM_EVENT_PROFILE_REPORT_HH__
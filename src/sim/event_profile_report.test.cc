@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "sim/event_profile_report.hh"
+
+using namespace gem5;
+using namespace gem5::event_profile;
+
+namespace
+{
+
+bool
+isSimObject(const std::string &name)
+{
+    static const std::set<std::string> objects = {
+        "system", "system.cpu", "system.cpu.dcache", "system.membus",
+    };
+    return objects.count(name);
+}
+
+} // anonymous namespace
+
+TEST(EventProfileStrideTest, Range)
+{
+    Stride stride(0);
+    for (int i = 0; i < 10000; i++)
+        EXPECT_EQ(stride.next(1), 1u);
+
+    uint64_t sum = 0;
+    std::set<uint32_t> seen;
+    const int draws = 100000;
+    for (int i = 0; i < draws; i++) {
+        const uint32_t next = stride.next(8);
+        ASSERT_GE(next, 1u);
+        ASSERT_LE(next, 15u);
+        seen.insert(next);
+        sum += next;
+    }
+    EXPECT_EQ(seen.size(), 15u);
+    EXPECT_NEAR((double)sum / draws, 8.0, 0.05);
+}
+
+TEST(EventProfileStrideTest, Deterministic)
+{
+    Stride a(3), b(3), c(4);
+    bool differs = false;
+    for (int i = 0; i < 100; i++) {
+        const uint32_t next = a.next(100);
+        EXPECT_EQ(next, b.next(100));
+        differs |= next != c.next(100);
+    }
+    EXPECT_TRUE(differs);
+}
+
+/**
+ * A schedule repeating with the same period as the profile must still
+ * have all of its events sampled, in proportion.
+ */
+TEST(EventProfileStrideTest, NoAliasing)
+{
+    const uint32_t period = 4;
+    Stride stride(0);
+    std::vector<unsigned> samples(period);
+    uint32_t countdown = 1;
+    const unsigned events = 400000;
+    for (unsigned i = 0; i < events; i++) {
+        if (--countdown == 0) {
+            countdown = stride.next(period);
+            samples[i % period]++;
+        }
+    }
+    for (unsigned count : samples)
+        EXPECT_NEAR(count, events / period / period, events / 400);
+}
+
+TEST(EventProfileOwnerTest, OwnerOf)
+{
+    EXPECT_EQ(ownerOf("system.cpu", isSimObject), "system.cpu");
+    EXPECT_EQ(ownerOf("system.cpu.tickEvent", isSimObject), "system.cpu");
+    EXPECT_EQ(ownerOf("system.cpu.dcache.mem_side_port-SendEvent",
+                      isSimObject), "system.cpu.dcache");
+    EXPECT_EQ(ownerOf("system.l2.respEvent", isSimObject), "system");
+    EXPECT_EQ(ownerOf("Global event", isSimObject), "(not a SimObject)");
+    EXPECT_EQ(ownerOf("", isSimObject), "(not a SimObject)");
+}
+
+TEST(EventProfileReportTest, WriteReport)
+{
+    std::map<std::string, Stats> by_event;
+    auto add = [&](const std::string &name, Counter samples,
+                   uint64_t host_ns) {
+        by_event[name] = Stats{name, samples, host_ns};
+    };
+    add("system.cpu.tickEvent", 100, 3000000);
+    add("system.cpu.dcache.respEvent", 10, 500000);
+    add("system.membus.reqLayer0.wrapped_function_event", 20, 1000000);
+    add("system.cpu.fetchEvent", 50, 1000000);
+    add("Global event", 4, 500000);
+
+    std::ostringstream os;
+    writeReport(os, 10, by_event, isSimObject);
+
+    const std::string expected =
+        "Event profile: on average one in 10 events timed, 184 samples, "
+        "6.000 ms of sampled host time\n"
+        "Estimated host time and event counts are scaled by the "
+        "sampling period\n"
+        "\n"
+        "Host time per SimObject\n"
+        "     host ms       %         events   ns/event  name\n"
+        "      40.000   66.67           1500    26666.7  system.cpu\n"
+        "      10.000   16.67            200    50000.0  system.membus\n"
+        "       5.000    8.33             40   125000.0  "
+        "(not a SimObject)\n"
+        "       5.000    8.33            100    50000.0  "
+        "system.cpu.dcache\n"
+        "\n"
+        "Host time per event\n"
+        "     host ms       %         events   ns/event  name\n"
+        "      30.000   50.00           1000    30000.0  "
+        "system.cpu.tickEvent\n"
+        "      10.000   16.67            500    20000.0  "
+        "system.cpu.fetchEvent\n"
+        "      10.000   16.67            200    50000.0  "
+        "system.membus.reqLayer0.wrapped_function_event\n"
+        "       5.000    8.33             40   125000.0  Global event\n"
+        "       5.000    8.33            100    50000.0  "
+        "system.cpu.dcache.respEvent\n";
+    EXPECT_EQ(os.str(), expected);
+}
@@ -41,6 +41,7 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/event_profile.hh"
 
 namespace gem5
 {
@@ -57,6 +58,7 @@ uint32_t numMainEventQueues = 0;
 std::vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
+uint32_t eventProfilePeriod = 0;
 
 EventQueue *
 getEventQueue(uint32_t index)
@@ -220,7 +222,11 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (GEM5_UNLIKELY(eventProfilePeriod) && --profileCountdown == 0) {
+            processProfiled(event);
+        } else {
+            event->process();
+        }
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -416,8 +422,18 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), profileCountdown(1),
+      profile(nullptr)
+{
+}
+
+void
+EventQueue::processProfiled(Event *event)
 {
+    if (!profile)
+        profile = EventProfile::get(this);
+    profileCountdown = profile->nextCountdown();
+    profile->process(event);
 }
 
 void
@@ -55,6 +55,7 @@
 namespace gem5
 {
 
+class EventProfile;
 class EventQueue;       // forward declaration
 class BaseGlobalEvent;
 
@@ -79,6 +80,10 @@ extern __thread EventQueue *_curEventQueue;
 //! Current mode of execution: parallel / serial
 extern bool inParallelMode;
 
+//! Time on average one in this many events with the event profile, 0 if
+//! disabled (see EventProfile).
+extern uint32_t eventProfilePeriod;
+
 //! Function for returning eventq queue for the provided
 //! index. The function allocates a new queue in case one
 //! does not exist for the index, provided that the index
@@ -634,6 +639,12 @@ class EventQueue
     //! List of events added by other threads to this event queue.
     std::list<Event*> async_queue;
 
+    //! Events left to service before the event profile times one.
+    uint32_t profileCountdown;
+
+    //! Host time accounting of this queue, created on the first sample.
+    EventProfile *profile;
+
     /**
      * Lock protecting event handling.
      *
@@ -666,6 +677,9 @@ class EventQueue
     //! owning thread, should call this function instead of insert().
     void asyncInsert(Event *event);
 
+    //! Process an event, timing it for the event profile.
+    void processProfiled(Event *event);
+
     EventQueue(const EventQueue &);
 
   public:
@@ -953,6 +967,7 @@ class EventQueue
      */
     void lock() { service_mutex.lock(); }
     void unlock() { service_mutex.unlock(); }
+    bool try_lock() { return service_mutex.try_lock(); }
     /**@}*/
 
     /**
@@ -1012,6 +1027,17 @@ class EventManager
         return eventq;
     }
 
+    /**
+     * Whether the calling thread simulates the event queue of this
+     * object. Objects that are not thread-safe check this where other
+     * objects call them, to catch accesses from another event queue.
+     */
+    bool
+    onOwnQueue() const
+    {
+        return !inParallelMode || curEventQueue() == eventq;
+    }
+
     /**
      * @ingroup api_eventq
      */
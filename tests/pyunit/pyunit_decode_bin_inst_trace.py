@@ -0,0 +1,187 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import gzip
+import importlib.util
+import io
+import os
+import struct
+import unittest
+
+# The decoder is a standalone script of util/
+_decoder_path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             os.pardir, os.pardir, 'util',
+                             'decode_bin_inst_trace.py')
+_spec = importlib.util.spec_from_file_location('decode_bin_inst_trace',
+                                               _decoder_path)
+decoder = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(decoder)
+
+def _name(name):
+    data = name.encode()
+    return struct.pack('=H', len(data)) + data
+
+class TraceWriter(object):
+    """Writes a trace as laid out in src/cpu/bin_inst_trace.hh, the way
+    the BinInstTracer does."""
+
+    def __init__(self, symbols, compound_flags, full_system=False):
+        self.chunks = []
+        header = struct.pack('=IIQB7xQQ', decoder.MAGIC, decoder.VERSION,
+                             10 ** 12, full_system, len(symbols),
+                             len(compound_flags))
+        for address, name in symbols:
+            header += struct.pack('=Q', address) + _name(name)
+        for name, kids in compound_flags.items():
+            header += _name(name) + struct.pack('=H', len(kids))
+            for kid in kids:
+                header += _name(kid)
+        self.chunk(decoder.GLOBAL_STREAM, header)
+        self.seq = 0
+
+    def chunk(self, stream, data):
+        self.chunks.append(struct.pack('=II', stream, len(data)) + data)
+
+    @staticmethod
+    def context(thread_id, cpu_name):
+        return bytes([decoder.TAG_CONTEXT]) + \
+            struct.pack('=H', thread_id) + _name(cpu_name)
+
+    @staticmethod
+    def inst_def(inst_id, disassembly, op_class='IntAlu', flags=0,
+                 inst_flags='IsInteger'):
+        strings = [ s.encode() for s in (disassembly, op_class, inst_flags) ]
+        return bytes([decoder.TAG_INST_DEF]) + \
+            struct.pack('=IBBHHH', inst_id, flags, 0,
+                        *[ len(s) for s in strings ]) + b''.join(strings)
+
+    def inst(self, when, pc, inst_id, flags=decoder.USER_MODE, addr=0,
+             data=0, data_status=0, macroop=0, micro_pc=0, result=None):
+        entry = bytes([decoder.TAG_INST]) + \
+            struct.pack('=QQQQQQQIIiHBB', self.seq, when, pc, addr, data,
+                        0, 0, inst_id, macroop, 0, micro_pc, flags,
+                        data_status)
+        self.seq += 1
+        if result is not None:
+            entry += bytes([decoder.TAG_RESULT]) + _name(result)
+        return entry
+
+    def decode(self, debug_flags):
+        out = io.StringIO()
+        data = gzip.compress(b''.join(self.chunks))
+        with gzip.open(io.BytesIO(data), 'rb') as trace:
+            decoder.Decoder(trace, debug_flags.split(','), out).run()
+        return out.getvalue().splitlines()
+
+EXEC = [ 'ExecEnable', 'ExecOpClass', 'ExecThread', 'ExecEffAddr',
+         'ExecResult', 'ExecSymbol', 'ExecMicro', 'ExecMacro',
+         'ExecFaulting', 'ExecUser', 'ExecKernel' ]
+
+class DecodeBinInstTraceTestSuite(unittest.TestCase):
+    def writer(self):
+        return TraceWriter([ (0x1000, 'main') ],
+                           { 'Exec': EXEC,
+                             'ExecNoTicks': [ 'Exec', 'FmtTicksOff' ] })
+
+    def test_exec(self):
+        w = self.writer()
+        w.chunk(0, w.context(0, 'system.cpu') +
+                w.inst_def(0, 'add r1, r2, r3') +
+                w.inst(500, 0x1000, 0, data=5, data_status=1) +
+                w.inst_def(1, 'ldr r1, [r2]', 'MemRead') +
+                w.inst(1000, 0x1004, 1, data=7, data_status=1,
+                       addr=0x2000, flags=decoder.USER_MODE |
+                       decoder.MEM_VALID))
+        self.assertEqual(w.decode('Exec'), [
+            '    500: system.cpu: T0 : 0x1000 @main    : %-26s : IntAlu : '
+            ' D=0x0000000000000005' % 'add r1, r2, r3',
+            '   1000: system.cpu: T0 : 0x1004 @main+4    : %-26s : '
+            'MemRead :  D=0x0000000000000007 A=0x2000' % 'ldr r1, [r2]',
+        ])
+
+    def test_compound_flags(self):
+        """Compound flags are expanded as defined in the trace."""
+        w = self.writer()
+        w.chunk(0, w.context(0, 'system.cpu') +
+                w.inst_def(0, 'nop') + w.inst(500, 0x1000, 0))
+        self.assertEqual(w.decode('ExecNoTicks'), [
+            'system.cpu: T0 : 0x1000 @main    : %-26s : IntAlu : ' % 'nop',
+        ])
+        self.assertEqual(w.decode('ExecEnable,ExecUser'), [
+            '    500: system.cpu: 0x1000    : %-26s : ' % 'nop',
+        ])
+        self.assertEqual(w.decode('ExecEnable,ExecKernel'), [])
+
+    def test_faulting(self):
+        """Faulting instructions are recorded, and only printed with
+        ExecFaulting."""
+        w = self.writer()
+        w.chunk(0, w.context(0, 'system.cpu') +
+                w.inst_def(0, 'svc #0') +
+                w.inst(500, 0x1000, 0,
+                       flags=decoder.USER_MODE | decoder.FAULTING))
+        self.assertEqual(len(w.decode('Exec')), 1)
+        self.assertEqual(w.decode('ExecEnable,ExecUser'), [])
+
+    def test_microops(self):
+        w = self.writer()
+        micro = decoder.MICROOP
+        w.chunk(0, w.context(0, 'system.cpu') +
+                w.inst_def(0, 'push r1, r2') +
+                w.inst_def(1, 'st r1', flags=micro | decoder.FIRST_MICROOP) +
+                w.inst_def(2, 'st r2', flags=micro | decoder.LAST_MICROOP) +
+                w.inst(500, 0x1000, 1, macroop=0, micro_pc=0,
+                       flags=decoder.USER_MODE | decoder.HAS_MACROOP) +
+                w.inst(1000, 0x1000, 2, macroop=0, micro_pc=1,
+                       flags=decoder.USER_MODE | decoder.HAS_MACROOP))
+        flags = 'ExecEnable,ExecUser,ExecMacro,FmtTicksOff'
+        self.assertEqual(w.decode(flags), [
+            'system.cpu: 0x1000    : %-26s' % 'push r1, r2',
+        ])
+        self.assertEqual(w.decode(flags + ',ExecMicro'), [
+            'system.cpu: 0x1000    : %-26s' % 'push r1, r2',
+            'system.cpu: 0x1000. 0 : %-26s : ' % 'st r1',
+            'system.cpu: 0x1000. 1 : %-26s : ' % 'st r2',
+        ])
+
+    def test_streams(self):
+        """The instructions of interleaved streams are merged in
+        order."""
+        w = self.writer()
+        first = w.context(0, 'system.cpu0') + w.inst_def(0, 'a') + \
+            w.inst(500, 0x1000, 0)
+        second = w.context(0, 'system.cpu1') + w.inst_def(0, 'b') + \
+            w.inst(500, 0x2000, 0)
+        first += w.inst(1000, 0x1004, 0)
+        w.chunk(1, second)
+        w.chunk(0, first)
+        self.assertEqual(
+            [ line.split(':')[1] for line in
+              w.decode('ExecEnable,ExecUser') ],
+            [ ' system.cpu0', ' system.cpu1', ' system.cpu0' ])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,73 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+
+import importlib.util
+import io
+import os
+import unittest
+
+# The benchmark is a standalone script of util/
+_bench_path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           os.pardir, os.pardir, 'util',
+                           'ruby_transition_bench.py')
+_spec = importlib.util.spec_from_file_location('ruby_transition_bench',
+                                               _bench_path)
+bench = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(bench)
+
+STATS = """
+---------- Begin Simulation Statistics ----------
+simSeconds                                   0.000100 # (Second)
+hostSeconds                                      2.50 # (Second)
+system.ruby.L1Cache_Controller.Load      |         100 |         200 # (Count)
+system.ruby.L1Cache_Controller.Load::total          300 # (Count)
+system.ruby.L1Cache_Controller.Store     |          50 |          50 # (Count)
+system.ruby.L1Cache_Controller.Store::total          100 # (Count)
+system.ruby.L1Cache_Controller.I.Load    |         100 |         200 # (Count)
+system.ruby.L1Cache_Controller.I.Load::total          300 # (Count)
+system.ruby.Directory_Controller.GETS             150 # (Count)
+system.ruby.Directory_Controller.I.GETS           150 # (Count)
+system.ruby.l1_cntrl0.fully_busy_cycles             7 # (Count)
+---------- End Simulation Statistics   ----------
+
+---------- Begin Simulation Statistics ----------
+hostSeconds                                      9.00 # (Second)
+system.ruby.L1Cache_Controller.Load::total         1000 # (Count)
+---------- End Simulation Statistics   ----------
+"""
+
+class ParseTests(unittest.TestCase):
+    def test_transitions(self):
+        host_seconds, transitions = bench.parse(io.StringIO(STATS))
+        self.assertEqual(host_seconds, 2.5)
+        # Events only, per state and event counts are the same
+        # transitions again
+        self.assertEqual(transitions, { 'L1Cache' : 400, 'Directory' : 150 })
+
+    def test_empty(self):
+        self.assertEqual(bench.parse(io.StringIO('')), (None, {}))
+
+if __name__ == '__main__':
+    unittest.main()
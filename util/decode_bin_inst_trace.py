@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script renders a binary instruction trace written by the
+# BinInstTracer in the text format of the ExeTracer, as if gem5 had been
+# run with the given debug flags. The layout of the trace is described
+# in src/cpu/bin_inst_trace.hh.
+
+import argparse
+import bisect
+import gzip
+import struct
+import sys
+
+MAGIC = 0x74623567
+VERSION = 2
+GLOBAL_STREAM = 0xffffffff
+
+CHUNK_HEADER = struct.Struct('=II')
+FILE_HEADER = struct.Struct('=IIQB7xQQ')
+SYMBOL = struct.Struct('=QH')
+CONTEXT = struct.Struct('=HH')
+INST_DEF = struct.Struct('=IBBHHH')
+INST = struct.Struct('=QQQQQQQIIiHBB')
+LENGTH = struct.Struct('=H')
+
+TAG_CONTEXT, TAG_INST_DEF, TAG_INST, TAG_RESULT = range(4)
+
+# InstDef flags
+MICROOP, FIRST_MICROOP, LAST_MICROOP = 1, 2, 4
+
+# InstEntry flags
+USER_MODE = 1 << 0
+MEM_VALID = 1 << 1
+FETCH_SEQ_VALID = 1 << 2
+CP_SEQ_VALID = 1 << 3
+PREDICATE_FALSE = 1 << 4
+FAULTING = 1 << 5
+HAS_MACROOP = 1 << 6
+
+# InstRecord::DataStatus
+DATA_INVALID, DATA_VEC, DATA_VEC_PRED = 0, 5, 6
+
+def expand_flags(names, compound_flags):
+    """Expands the compound flags among the names of debug flags."""
+    flags = set()
+    for name in names:
+        if name in compound_flags:
+            flags |= expand_flags(compound_flags[name], compound_flags)
+        else:
+            flags.add(name)
+    return flags
+
+class InstDef(object):
+    def __init__(self, flags, disassembly, op_class, inst_flags):
+        self.is_microop = bool(flags & MICROOP)
+        self.is_first_microop = bool(flags & FIRST_MICROOP)
+        self.is_last_microop = bool(flags & LAST_MICROOP)
+        self.disassembly = disassembly
+        self.op_class = op_class
+        self.flags = inst_flags
+
+class Stream(object):
+    def __init__(self):
+        self.thread_id = 0
+        self.cpu_name = ''
+        self.insts = {}
+
+class Inst(object):
+    def __init__(self, stream, fields):
+        (self.seq, self.when, self.pc, self.addr, self.data,
+         self.fetch_seq, self.cp_seq, inst, macroop, self.asid,
+         self.micro_pc, self.flags, self.data_status) = fields
+        self.stream = stream
+        self.inst = stream.insts[inst]
+        self.macroop = stream.insts[macroop] \
+            if self.flags & HAS_MACROOP else None
+        self.result = None
+
+class Decoder(object):
+    def __init__(self, trace, flag_names, out):
+        self.trace = trace
+        self.flag_names = flag_names
+        # Expanded once the compound flags are read from the trace
+        self.flags = None
+        self.out = out
+        self.full_system = False
+        self.symbols = []
+        self.symbol_addrs = []
+        self.streams = {}
+
+    def read_chunks(self):
+        while True:
+            header = self.trace.read(CHUNK_HEADER.size)
+            if not header:
+                return
+            if len(header) != CHUNK_HEADER.size:
+                raise EOFError("Truncated chunk header")
+            stream, size = CHUNK_HEADER.unpack(header)
+            data = self.trace.read(size)
+            if len(data) != size:
+                raise EOFError("Truncated chunk")
+            yield stream, data
+
+    def parse_header(self, data):
+        magic, version, tick_freq, full_system, num_symbols, \
+            num_compound_flags = FILE_HEADER.unpack_from(data, 0)
+        if magic != MAGIC:
+            sys.exit("Not a binary instruction trace")
+        if version != VERSION:
+            sys.exit("Unsupported trace version %d" % version)
+        self.full_system = bool(full_system)
+
+        # Keep the last symbol inserted at an address, as the symbol
+        # table lookups of gem5 do.
+        offset = FILE_HEADER.size
+        symbols = []
+        for i in range(num_symbols):
+            address, length = SYMBOL.unpack_from(data, offset)
+            offset += SYMBOL.size
+            name = self.read_string(data, offset, length)
+            offset += length
+            symbols.append((address, i, name))
+        symbols.sort()
+        self.symbols = symbols
+        self.symbol_addrs = [ sym[0] for sym in symbols ]
+
+        compound_flags = {}
+        for i in range(num_compound_flags):
+            name, offset = self.read_name(data, offset)
+            num_kids, = LENGTH.unpack_from(data, offset)
+            offset += LENGTH.size
+            kids = []
+            for j in range(num_kids):
+                kid, offset = self.read_name(data, offset)
+                kids.append(kid)
+            compound_flags[name] = kids
+        self.flags = expand_flags(self.flag_names, compound_flags)
+
+    def read_string(self, data, offset, length):
+        return data[offset:offset + length].decode(errors='replace')
+
+    def read_name(self, data, offset):
+        """Reads a string prefixed by its length, returns it and the
+        offset of what follows."""
+        length, = LENGTH.unpack_from(data, offset)
+        offset += LENGTH.size
+        return self.read_string(data, offset, length), offset + length
+
+    def parse_stream(self, stream, data):
+        """Yields the instructions of a chunk of a stream."""
+        offset = 0
+        last = None
+        while offset < len(data):
+            tag = data[offset]
+            offset += 1
+            if tag == TAG_CONTEXT:
+                stream.thread_id, length = CONTEXT.unpack_from(data, offset)
+                offset += CONTEXT.size
+                stream.cpu_name = self.read_string(data, offset, length)
+                offset += length
+            elif tag == TAG_INST_DEF:
+                inst_id, flags, _, dis_len, op_len, flags_len = \
+                    INST_DEF.unpack_from(data, offset)
+                offset += INST_DEF.size
+                strings = []
+                for length in (dis_len, op_len, flags_len):
+                    strings.append(self.read_string(data, offset, length))
+                    offset += length
+                stream.insts[inst_id] = InstDef(flags, *strings)
+            elif tag == TAG_INST:
+                if last:
+                    yield last
+                last = Inst(stream, INST.unpack_from(data, offset))
+                offset += INST.size
+            elif tag == TAG_RESULT:
+                length, = LENGTH.unpack_from(data, offset)
+                offset += LENGTH.size
+                last.result = self.read_string(data, offset, length)
+                offset += length
+            else:
+                raise ValueError("Unknown entry tag %d" % tag)
+        if last:
+            yield last
+
+    def instructions(self):
+        """Yields the instructions of all the streams, in order."""
+        pending = {}
+        next_seq = 0
+        for stream_id, data in self.read_chunks():
+            if stream_id == GLOBAL_STREAM:
+                self.parse_header(data)
+                continue
+
+            if self.flags is None:
+                raise ValueError("Instructions before the trace header")
+            stream = self.streams.setdefault(stream_id, Stream())
+            for inst in self.parse_stream(stream, data):
+                pending[inst.seq] = inst
+            while next_seq in pending:
+                yield pending.pop(next_seq)
+                next_seq += 1
+
+        for seq in sorted(pending):
+            yield pending[seq]
+
+    def find_symbol(self, addr):
+        i = bisect.bisect_right(self.symbol_addrs, addr)
+        if i == 0:
+            return None
+        return self.symbols[i - 1]
+
+    def trace_inst(self, record, inst, ran):
+        flags = self.flags
+        in_user_mode = bool(record.flags & USER_MODE)
+        if in_user_mode and 'ExecUser' not in flags:
+            return
+        if not in_user_mode and 'ExecKernel' not in flags:
+            return
+
+        outs = []
+        if 'ExecAsid' in flags:
+            outs.append("A%d " % record.asid)
+        if 'ExecThread' in flags:
+            outs.append("T%d : " % record.stream.thread_id)
+
+        cur_pc = record.pc
+        outs.append("%#x" % cur_pc if cur_pc else "0")
+        if 'ExecSymbol' in flags and \
+                (not self.full_system or not in_user_mode):
+            symbol = self.find_symbol(cur_pc)
+            if symbol:
+                delta = cur_pc - symbol[0]
+                if delta:
+                    outs.append(" @%s+%d" % (symbol[2], delta))
+                else:
+                    outs.append(" @%s" % symbol[2])
+
+        if inst.is_microop:
+            outs.append(".%2d" % record.micro_pc)
+        else:
+            outs.append("   ")
+
+        outs.append(" : ")
+        outs.append("%-26s" % inst.disassembly)
+
+        if ran:
+            outs.append(" : ")
+
+            if 'ExecOpClass' in flags:
+                outs.append(inst.op_class + " : ")
+
+            if 'ExecResult' in flags and record.flags & PREDICATE_FALSE:
+                outs.append("Predicated False")
+
+            if 'ExecResult' in flags and \
+                    record.data_status != DATA_INVALID:
+                if record.data_status in (DATA_VEC, DATA_VEC_PRED):
+                    outs.append(" D=%s" % record.result)
+                else:
+                    outs.append(" D=%#018x" % record.data)
+
+            if 'ExecEffAddr' in flags and record.flags & MEM_VALID:
+                outs.append(" A=0x%x" % record.addr)
+
+            if 'ExecFetchSeq' in flags and record.flags & FETCH_SEQ_VALID:
+                outs.append("  FetchSeq=%d" % record.fetch_seq)
+
+            if 'ExecCPSeq' in flags and record.flags & CP_SEQ_VALID:
+                outs.append("  CPSeq=%d" % record.cp_seq)
+
+            if 'ExecFlags' in flags:
+                outs.append("  flags=(%s)" % inst.flags)
+
+        prefix = []
+        if 'FmtTicksOff' not in flags:
+            prefix.append("%7d: " % record.when)
+        if 'FmtFlag' in flags:
+            prefix.append("ExecEnable: ")
+        prefix.append(record.stream.cpu_name + ": ")
+
+        self.out.write("".join(prefix + outs) + "\n")
+
+    def dump(self, record):
+        # Same selection of macroops and microops as
+        # ExeTracerRecord::dump()
+        flags = self.flags
+        inst = record.inst
+        macroop = record.macroop
+        if record.flags & FAULTING and 'ExecFaulting' not in flags:
+            return
+        if 'ExecMacro' in flags and inst.is_microop and macroop and \
+                (('ExecMicro' in flags and inst.is_first_microop) or
+                 ('ExecMicro' not in flags and inst.is_last_microop)):
+            self.trace_inst(record, macroop, False)
+        if 'ExecMicro' in flags or not inst.is_microop:
+            self.trace_inst(record, inst, True)
+
+    def run(self):
+        for record in self.instructions():
+            self.dump(record)
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Render a binary instruction trace as text")
+    parser.add_argument("trace", help="Binary instruction trace")
+    parser.add_argument("output", nargs="?",
+                        help="Text output, stdout if omitted")
+    parser.add_argument("--debug-flags", default="Exec",
+                        help="Comma separated debug flags, as given to "
+                        "gem5, selecting what is rendered "
+                        "(default: %(default)s)")
+    args = parser.parse_args()
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    with gzip.open(args.trace, 'rb') as trace:
+        Decoder(trace, args.debug_flags.split(','), out).run()
+    if out is not sys.stdout:
+        out.close()
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,150 @@
+#! /usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Report coherence protocol bottlenecks from a Ruby stats.txt file.
+#
+# The SLICC generated controllers profile the time lines spend in
+# transient states (transientStateLatHist), the message buffers profile
+# how long stalled messages wait to be reanalyzed (m_stall_wait_time) and
+# every controller reports its most contended lines (stallHotLines). This
+# script ranks them and flags the entries that stand out, so protocol
+# induced performance problems can be found without ProtocolTrace.
+
+import argparse
+import re
+import sys
+
+stat_re = re.compile(r'^(\S+)\s+(\S+)')
+
+def parse(stats_file, dump):
+    '''Return a dict with the stats of the requested dump.'''
+    stats = {}
+    cur_dump = 0
+    for line in stats_file:
+        if line.startswith('---------- Begin'):
+            cur_dump += 1
+            continue
+        if cur_dump != dump:
+            continue
+        m = stat_re.match(line)
+        if not m:
+            continue
+        try:
+            stats[m.group(1)] = float(m.group(2))
+        except ValueError:
+            pass
+    return stats
+
+def histograms(stats, name):
+    '''Collect (owner, key, samples, mean) for histograms called
+    <owner>.<name>.<key> or <owner>.<name>.'''
+    hist_re = re.compile(r'^(.*)\.%s(?:\.(\w+))?::samples$' % name)
+    result = []
+    for stat, samples in stats.items():
+        m = hist_re.match(stat)
+        if not m or samples == 0:
+            continue
+        mean = stats.get(stat[:-len('samples')] + 'mean', 0.0)
+        result.append((m.group(1), m.group(2), int(samples), mean))
+    return result
+
+def flag(value, values, factor):
+    '''Flag values larger than factor times the median.'''
+    values = sorted(values)
+    median = values[len(values) // 2] if values else 0
+    return ' <--' if median and value > factor * median else ''
+
+def report_transient_states(stats, args):
+    hists = histograms(stats, 'transientStateLatHist')
+    hists.sort(key=lambda h: h[2] * h[3], reverse=True)
+    totals = [ h[2] * h[3] for h in hists ]
+
+    print('Transient state residency (cycles, sorted by total time)')
+    print('%-48s %-16s %10s %10s %12s' %
+          ('controller', 'state', 'samples', 'mean', 'total'))
+    for owner, state, samples, mean in hists[:args.top]:
+        total = samples * mean
+        print('%-48s %-16s %10d %10.1f %12.0f%s' %
+              (owner, state, samples, mean, total,
+               flag(total, totals, args.factor)))
+    print()
+
+def report_stall_waits(stats, args):
+    hists = histograms(stats, 'm_stall_wait_time')
+    hists.sort(key=lambda h: h[2] * h[3], reverse=True)
+    means = [ h[3] for h in hists ]
+
+    print('Stall-and-wait durations (ticks, sorted by total time)')
+    print('%-64s %10s %12s' % ('message buffer', 'samples', 'mean'))
+    for owner, _, samples, mean in hists[:args.top]:
+        print('%-64s %10d %12.0f%s' %
+              (owner, samples, mean, flag(mean, means, args.factor)))
+    print()
+
+def report_hot_lines(stats, args):
+    line_re = re.compile(r'^(.*)\.stallHotLines::(\d+)$')
+    lines = []
+    for stat, count in stats.items():
+        m = line_re.match(stat)
+        if m and count:
+            addr = stats.get('%s.stallHotLineAddrs::%s' % m.groups(), 0)
+            lines.append((m.group(1), '%#x' % int(addr), int(count)))
+    lines.sort(key=lambda l: l[2], reverse=True)
+    counts = [ l[2] for l in lines ]
+
+    print('Most contended lines (stall_and_wait stalls)')
+    print('%-48s %-18s %10s' % ('controller', 'line', 'stalls'))
+    for owner, addr, count in lines[:args.top]:
+        print('%-48s %-18s %10d%s' %
+              (owner, addr, count, flag(count, counts, args.factor)))
+    print()
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Flag coherence protocol bottlenecks in Ruby stats')
+    parser.add_argument('stats', type=argparse.FileType('r'),
+                        help='stats.txt file of a Ruby simulation')
+    parser.add_argument('--dump', type=int, default=1,
+                        help='stats dump to analyze (default: 1)')
+    parser.add_argument('--top', type=int, default=20,
+                        help='entries to report per category (default: 20)')
+    parser.add_argument('--factor', type=float, default=4.0,
+                        help='flag entries larger than this multiple of '
+                             'the median (default: 4)')
+    args = parser.parse_args()
+
+    stats = parse(args.stats, args.dump)
+    if not stats:
+        sys.exit('No stats found in dump %d' % args.dump)
+
+    report_transient_states(stats, args)
+    report_stall_waits(stats, args)
+    report_hot_lines(stats, args)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,138 @@
+#! /usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+# Build a Ruby cache snapshot from packet traces.
+#
+# Each input is a protobuf packet trace of the requests one CPU sent to
+# its L1 caches, as written by a MemTraceProbe attached to the CPU ports
+# while fast-forwarding with any CPU model. The n-th trace warms the n-th
+# Ruby sequencer. Every trace is run through an LRU model of the given
+# capacity and the surviving lines are written out, oldest first, in the
+# format read by the cache_snapshot parameter of RubySystem (see
+# src/mem/ruby/system/CacheRecorder.hh).
+
+import argparse
+import gzip
+import heapq
+import os
+import protolib
+import struct
+import subprocess
+import sys
+from collections import OrderedDict
+
+util_dir = os.path.dirname(os.path.realpath(__file__))
+# Make sure the proto definitions are up to date.
+subprocess.check_call(['make', '--quiet', '-C', util_dir, 'packet_pb2.py'])
+import packet_pb2
+
+SNAPSHOT_MAGIC = b'gem5csnp'
+SNAPSHOT_VERSION = 1
+
+# Record types, see CacheSnapshotRecord
+LOAD, STORE, IFETCH = 0, 1, 2
+
+# ReadReq is 1 and WriteReq is 4 in src/mem/packet.hh Command enum
+READ_REQ, WRITE_REQ = 1, 4
+# Request::INST_FETCH in src/mem/request.hh
+INST_FETCH = 0x100
+
+def read_trace(filename, block_size, lines):
+    '''Return the (tick, addr, type) of the lines still cached at the end
+    of a trace in an LRU cache of the given number of lines.'''
+    proto_in = protolib.openFileRd(filename)
+    if proto_in.read(4).decode() != 'gem5':
+        sys.exit('Unrecognized file %s' % filename)
+
+    header = packet_pb2.PacketHeader()
+    protolib.decodeMessage(proto_in, header)
+
+    cache = OrderedDict()
+    packet = packet_pb2.Packet()
+    while protolib.decodeMessage(proto_in, packet):
+        if packet.cmd == READ_REQ:
+            fetch = packet.HasField('flags') and packet.flags & INST_FETCH
+            req_type = IFETCH if fetch else LOAD
+        elif packet.cmd == WRITE_REQ:
+            req_type = STORE
+        else:
+            continue
+
+        first = packet.addr & ~(block_size - 1)
+        last = (packet.addr + max(packet.size, 1) - 1) & ~(block_size - 1)
+        for addr in range(first, last + block_size, block_size):
+            # Dirty lines stay dirty until evicted
+            prev = cache.pop(addr, None)
+            dirty = prev is not None and prev[1] == STORE
+            cache[addr] = (packet.tick, STORE if dirty else req_type)
+            if len(cache) > lines:
+                cache.popitem(last=False)
+
+    proto_in.close()
+    return [ (tick, addr, req_type)
+             for addr, (tick, req_type) in cache.items() ]
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Build a Ruby cache snapshot from packet traces')
+    parser.add_argument('traces', nargs='+',
+                        help='packet trace per sequencer, in sequencer order')
+    parser.add_argument('-o', '--output', required=True,
+                        help='snapshot file to write (gzip compressed)')
+    parser.add_argument('--block-size', type=int, default=64,
+                        help='cache block size in bytes (default: 64)')
+    parser.add_argument('--lines', type=int, default=1024,
+                        help='lines kept per sequencer, usually the L1 '
+                             'capacity (default: 1024)')
+    args = parser.parse_args()
+
+    if args.block_size & (args.block_size - 1):
+        sys.exit('The block size must be a power of two')
+
+    per_seq = []
+    for seq, trace in enumerate(args.traces):
+        lines = read_trace(trace, args.block_size, args.lines)
+        per_seq.append([ (tick, seq, addr, req_type)
+                         for tick, addr, req_type in lines ])
+        print('%s: %d lines' % (trace, len(lines)))
+
+    # Interleave the sequencers by the time of the last access so lines
+    # shared between caches end up with the most recent owner.
+    records = list(heapq.merge(*per_seq))
+
+    with gzip.open(args.output, 'wb') as out:
+        out.write(struct.pack('<8sIIQ', SNAPSHOT_MAGIC, SNAPSHOT_VERSION,
+                              args.block_size, len(records)))
+        for tick, seq, addr, req_type in records:
+            out.write(struct.pack('<QIB3x', addr, seq, req_type))
+
+    print('Wrote %d records to %s' % (len(records), args.output))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,164 @@
+#! /usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+# Measure the host time per SLICC transition of Ruby protocols.
+#
+# Each gem5 binary given on the command line is run on the Ruby random
+# tester, and the host time of the simulation (hostSeconds) is divided
+# by the number of transitions taken by all the controllers (the totals
+# of the <Machine>_Controller.<Event> stats). Giving a baseline and a
+# modified build of the same protocol shows the change in the cost of a
+# transition, e.g. of the generated dispatch code:
+#
+#   ruby_transition_bench.py \
+#       MESI_Two_Level=build/X86_MESI_Two_Level/gem5.fast \
+#       CHI=build/ARM/gem5.fast
+#
+# Each configuration is run several times and the fastest run is kept,
+# which filters out noise from the host. Stats files of earlier runs can
+# be summarized with --stats.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+config_root = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           os.pardir, 'configs')
+
+stat_re = re.compile(r'^(\S+)\s+(\S+)')
+event_re = re.compile(r'^system\.ruby\.(\w+)_Controller\.(\w+)(::total)?$')
+
+def parse(stats_file):
+    '''Return the host seconds and the transitions per machine type of
+    the first stats dump.'''
+    host_seconds = None
+    events = {}
+    totals = {}
+    dumps = 0
+    for line in stats_file:
+        if line.startswith('---------- Begin'):
+            dumps += 1
+            if dumps > 1:
+                break
+            continue
+        m = stat_re.match(line)
+        if not m:
+            continue
+        try:
+            value = float(m.group(2))
+        except ValueError:
+            # Vectors of more than one controller are printed on one line
+            # followed by their total
+            continue
+        if m.group(1) == 'hostSeconds':
+            host_seconds = value
+            continue
+        m = event_re.match(m.group(1))
+        if m:
+            # A vector of one controller has no total
+            table = totals if m.group(3) else events
+            key = (m.group(1), m.group(2))
+            table[key] = value
+    events.update(totals)
+
+    transitions = {}
+    for (machine, _), count in events.items():
+        transitions[machine] = transitions.get(machine, 0) + int(count)
+    return host_seconds, transitions
+
+def run(binary, args):
+    '''Run the random tester and return the parsed stats of the fastest
+    of args.repeat runs.'''
+    best = None
+    for _ in range(args.repeat):
+        with tempfile.TemporaryDirectory() as outdir:
+            cmd = [ binary, '--outdir', outdir,
+                    os.path.join(config_root, 'example',
+                                 'ruby_random_test.py'),
+                    '--num-cpus', str(args.num_cpus),
+                    '--maxloads', str(args.maxloads) ] + args.extra
+            subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+            with open(os.path.join(outdir, 'stats.txt')) as stats_file:
+                result = parse(stats_file)
+        if best is None or result[0] < best[0]:
+            best = result
+    return best
+
+def report(results):
+    print('%-24s %12s %10s %12s  %s' %
+          ('configuration', 'transitions', 'host s', 'ns/trans',
+           'transitions per machine'))
+    for label, (host_seconds, transitions) in results:
+        total = sum(transitions.values())
+        if host_seconds is None or not total:
+            sys.exit('%s: no host time or transitions in the stats' % label)
+        machines = ', '.join('%s %d' % item
+                             for item in sorted(transitions.items()))
+        print('%-24s %12d %10.3f %12.1f  %s' %
+              (label, total, host_seconds, host_seconds * 1e9 / total,
+               machines))
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Measure the host time per transition of Ruby '
+                    'protocols')
+    parser.add_argument('configs', nargs='+', metavar='LABEL=FILE',
+                        help='gem5 binary to run, or stats.txt file with '
+                             '--stats, and the label to report it as')
+    parser.add_argument('--stats', action='store_true',
+                        help='summarize existing stats files instead of '
+                             'running gem5')
+    parser.add_argument('--num-cpus', type=int, default=4,
+                        help='tester ports (default: 4)')
+    parser.add_argument('--maxloads', type=int, default=100000,
+                        help='loads to check per run (default: 100000)')
+    parser.add_argument('--repeat', type=int, default=3,
+                        help='runs per configuration, the fastest is '
+                             'kept (default: 3)')
+    parser.add_argument('--extra', nargs=argparse.REMAINDER, default=[],
+                        help='further options for ruby_random_test.py')
+    args = parser.parse_args()
+
+    results = []
+    for config in args.configs:
+        label, sep, path = config.partition('=')
+        if not sep:
+            label, path = os.path.basename(config), config
+        if args.stats:
+            with open(path) as stats_file:
+                results.append((label, parse(stats_file)))
+        else:
+            results.append((label, run(path, args)))
+    report(results)
+
+if __name__ == '__main__':
+    main()